@@ -2,11 +2,15 @@
 
 #include "QuickBaker.h"
 #include "QuickBakerExporter.h" // For LogQuickBaker
+#include "QuickBakerProjectSettings.h"
+#include "QuickBakerRenderTargetPool.h"
+#include "QuickBakerTextureUpdateQueue.h"
 #include "SQuickBakerWidget.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "ToolMenus.h"
 #include "ContentBrowserMenuContexts.h"
+#include "ISettingsModule.h"
 
 static const FName QuickBakerTabName("QuickBaker");
 
@@ -21,6 +25,15 @@ void FQuickBakerModule::StartupModule()
 
 	// Register startup callbacks for menu extension
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FQuickBakerModule::RegisterMenus));
+
+	// Output rules are shared by the project, so they live in Project Settings rather than the window
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->RegisterSettings("Project", "Plugins", "QuickBaker",
+			LOCTEXT("ProjectSettingsName", "QuickBaker"),
+			LOCTEXT("ProjectSettingsDescription", "Texture settings applied to baked assets and the platforms their runtime memory is reported for."),
+			GetMutableDefault<UQuickBakerProjectSettings>());
+	}
 }
 
 void FQuickBakerModule::ShutdownModule()
@@ -31,8 +44,20 @@ void FQuickBakerModule::ShutdownModule()
 	// Unregister menu extensions
 	UToolMenus::UnregisterOwner(this);
 
+	// Remove the Project Settings page
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->UnregisterSettings("Project", "Plugins", "QuickBaker");
+	}
+
 	// Unregister the tab spawner
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(QuickBakerTabName);
+
+	// Free render targets kept alive for reuse between bakes
+	FQuickBakerRenderTargetPool::Empty();
+
+	// Stop the deferred texture updates; the textures rebuild their resources on next load
+	FQuickBakerTextureUpdateQueue::Empty();
 }
 
 void FQuickBakerModule::PluginButtonClicked()
@@ -0,0 +1,322 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerAnalysis.h"
+#include "QuickBakerCancellation.h"
+#include "Misc/ScopeLock.h"
+
+namespace QuickBakerAnalysis
+{
+	static constexpr int32 NumBins = 256;
+
+	/** Reads pixel Index of a source format as RGBA floats. Single-channel formats fill R only. */
+	static int32 ReadPixel(const uint8* Pixels, int64 Index, ETextureSourceFormat Format, float* OutValues)
+	{
+		switch (Format)
+		{
+		case TSF_BGRA8:
+		{
+			const uint8* Pixel = Pixels + Index * 4;
+			OutValues[0] = Pixel[2] / 255.0f;
+			OutValues[1] = Pixel[1] / 255.0f;
+			OutValues[2] = Pixel[0] / 255.0f;
+			OutValues[3] = Pixel[3] / 255.0f;
+			return 4;
+		}
+		case TSF_RGBA16F:
+		{
+			const FFloat16* Pixel = reinterpret_cast<const FFloat16*>(Pixels) + Index * 4;
+			for (int32 Channel = 0; Channel < 4; ++Channel)
+			{
+				OutValues[Channel] = Pixel[Channel].GetFloat();
+			}
+			return 4;
+		}
+		case TSF_G8:
+			OutValues[0] = Pixels[Index] / 255.0f;
+			return 1;
+		case TSF_G16:
+			OutValues[0] = reinterpret_cast<const uint16*>(Pixels)[Index] / 65535.0f;
+			return 1;
+		case TSF_R16F:
+			OutValues[0] = reinterpret_cast<const FFloat16*>(Pixels)[Index].GetFloat();
+			return 1;
+		case TSF_R32F:
+			OutValues[0] = reinterpret_cast<const float*>(Pixels)[Index];
+			return 1;
+		default:
+			return 0;
+		}
+	}
+
+	/** Round-trip error of storing Value as 8 bits over [Low, Low + Range]. */
+	static float GetQuantizationError(float Value, float Low, float Range)
+	{
+		if (Range <= 0.0f)
+		{
+			return FMath::Abs(Value - Low);
+		}
+		const float Normalized = FMath::Clamp((Value - Low) / Range, 0.0f, 1.0f);
+		const float Stored = FMath::RoundToFloat(Normalized * 255.0f) / 255.0f;
+		return FMath::Abs(Stored * Range + Low - Value);
+	}
+
+	/** Whether a channel fits 8 bits within MaxError, and the scale/bias that achieves it. */
+	static bool FitsIn8Bit(const FQuickBakerImageStats& Stats, int32 Channel, bool bAllowRemap, float MaxError, float& OutScale, float& OutBias)
+	{
+		const float Low = Stats.Min.Component(Channel);
+		const float High = Stats.Max.Component(Channel);
+
+		// Values already in the unorm range are stored as-is, so the texture still reads correctly without metadata
+		if (Low >= 0.0f && High <= 1.0f && Stats.DirectError8.Component(Channel) <= MaxError)
+		{
+			OutScale = 1.0f;
+			OutBias = 0.0f;
+			return true;
+		}
+
+		if (bAllowRemap && Stats.RemapError8.Component(Channel) <= MaxError)
+		{
+			OutScale = (High > Low) ? High - Low : 1.0f;
+			OutBias = Low;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+int32 FQuickBakerImageStats::GetUsedLevels(int32 Channel) const
+{
+	int32 UsedLevels = 0;
+	for (int32 Bin = 0; Bin < QuickBakerAnalysis::NumBins; ++Bin)
+	{
+		const int32 Index = Channel * QuickBakerAnalysis::NumBins + Bin;
+		UsedLevels += (Histogram.IsValidIndex(Index) && Histogram[Index] > 0) ? 1 : 0;
+	}
+	return UsedLevels;
+}
+
+bool FQuickBakerAnalysis::Analyze(const uint8* Pixels, int64 NumPixels, ETextureSourceFormat Format, FQuickBakerImageStats& OutStats, FQuickBakerCancellationToken& CancellationToken)
+{
+	using namespace QuickBakerAnalysis;
+
+	OutStats = FQuickBakerImageStats();
+
+	float FirstPixel[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	OutStats.NumChannels = (NumPixels > 0) ? ReadPixel(Pixels, 0, Format, FirstPixel) : 0;
+	if (OutStats.NumChannels == 0)
+	{
+		return false;
+	}
+	const int32 NumChannels = OutStats.NumChannels;
+
+	// Pass 1: range and structure. Each range accumulates locally and merges once under the lock.
+	FCriticalSection MergeLock;
+	const bool bRangeComplete = CancellationToken.ParallelForRange(NumPixels, [&](int64 Begin, int64 End)
+	{
+		float Min[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		bool bGrayscale = true;
+		bool bConstantColor = true;
+
+		float Values[4];
+		for (int64 Index = Begin; Index < End; ++Index)
+		{
+			ReadPixel(Pixels, Index, Format, Values);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Min[Channel] = FMath::Min(Min[Channel], Values[Channel]);
+				Max[Channel] = FMath::Max(Max[Channel], Values[Channel]);
+				bConstantColor &= Values[Channel] == FirstPixel[Channel];
+			}
+			if (NumChannels == 4)
+			{
+				bGrayscale &= Values[0] == Values[1] && Values[1] == Values[2];
+			}
+		}
+
+		FScopeLock Lock(&MergeLock);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutStats.Min.Component(Channel) = FMath::Min(OutStats.Min.Component(Channel), Min[Channel]);
+			OutStats.Max.Component(Channel) = FMath::Max(OutStats.Max.Component(Channel), Max[Channel]);
+		}
+		OutStats.bGrayscale &= bGrayscale;
+		OutStats.bConstantColor &= bConstantColor;
+	});
+
+	if (!bRangeComplete)
+	{
+		return false;
+	}
+
+	OutStats.bConstantAlpha = (NumChannels == 1) || OutStats.Min.A == OutStats.Max.A;
+
+	// Pass 2: quantization error of both 8-bit mappings, and the histogram over [Min, Max]
+	OutStats.Histogram.SetNumZeroed(NumChannels * NumBins);
+	const FQuickBakerImageStats Range = OutStats;
+	return CancellationToken.ParallelForRange(NumPixels, [&](int64 Begin, int64 End)
+	{
+		float DirectError[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float RemapError[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		uint32 Histogram[4 * NumBins] = {};
+
+		float Values[4];
+		for (int64 Index = Begin; Index < End; ++Index)
+		{
+			ReadPixel(Pixels, Index, Format, Values);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				const float Low = Range.Min.Component(Channel);
+				const float Span = Range.Max.Component(Channel) - Low;
+				DirectError[Channel] = FMath::Max(DirectError[Channel], GetQuantizationError(Values[Channel], 0.0f, 1.0f));
+				RemapError[Channel] = FMath::Max(RemapError[Channel], GetQuantizationError(Values[Channel], Low, Span));
+
+				const int32 Bin = (Span > 0.0f) ? FMath::Clamp((int32)((Values[Channel] - Low) / Span * NumBins), 0, NumBins - 1) : 0;
+				++Histogram[Channel * NumBins + Bin];
+			}
+		}
+
+		FScopeLock Lock(&MergeLock);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutStats.DirectError8.Component(Channel) = FMath::Max(OutStats.DirectError8.Component(Channel), DirectError[Channel]);
+			OutStats.RemapError8.Component(Channel) = FMath::Max(OutStats.RemapError8.Component(Channel), RemapError[Channel]);
+		}
+		for (int32 Bin = 0; Bin < NumChannels * NumBins; ++Bin)
+		{
+			OutStats.Histogram[Bin] += Histogram[Bin];
+		}
+	});
+}
+
+FQuickBakerFormatChoice FQuickBakerAnalysis::ChooseFormat(const FQuickBakerImageStats& Stats, ETextureSourceFormat Format, TextureCompressionSettings Compression, const FIntPoint& Size, bool bAllowRemap, float MaxError)
+{
+	using namespace QuickBakerAnalysis;
+
+	FQuickBakerFormatChoice Choice;
+	Choice.Format = Format;
+	Choice.Compression = Compression;
+	Choice.Size = Size;
+
+	// Only plain color and data settings may change format; the others define what their channels mean
+	const bool bCanChange = Compression == TC_Default || Compression == TC_HDR || Compression == TC_Grayscale
+		|| Compression == TC_HalfFloat || Compression == TC_SingleFloat;
+	if (!bCanChange || Stats.NumChannels == 0)
+	{
+		return Choice;
+	}
+
+	// A single color needs no more than one compression block
+	if (Stats.bConstantColor)
+	{
+		Choice.Size = FIntPoint(FMath::Min(Size.X, 4), FMath::Min(Size.Y, 4));
+		return Choice;
+	}
+
+	float Scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	float Bias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	// Grayscale with constant alpha: one channel carries everything
+	if (Stats.bGrayscale && Stats.bConstantAlpha)
+	{
+		if (FitsIn8Bit(Stats, 0, bAllowRemap, MaxError, Scale[0], Bias[0]))
+		{
+			Choice.Format = TSF_G8;
+			Choice.Compression = TC_Grayscale;
+		}
+		else if (Format == TSF_RGBA16F)
+		{
+			Choice.Format = TSF_R16F;
+			Choice.Compression = TC_HalfFloat;
+		}
+		else if (Format == TSF_R32F && Stats.Min.R >= 0.0f && Stats.Max.R <= 1.0f && MaxError >= 0.5f / 65535.0f)
+		{
+			// 16-bit unorm rounds to within half a step of 1/65535 anywhere in [0, 1]
+			Choice.Format = TSF_G16;
+			Choice.Compression = TC_Grayscale;
+		}
+
+		if (Choice.Format != Format)
+		{
+			Choice.Scale = FLinearColor(Scale[0], Scale[0], Scale[0], 1.0f);
+			Choice.Bias = FLinearColor(Bias[0], Bias[0], Bias[0], 0.0f);
+			Choice.ConstantAlpha = (Stats.NumChannels == 4) ? Stats.Min.A : 1.0f;
+		}
+		return Choice;
+	}
+
+	// Color data baked at 16 bits that 8 bits represent within the error bound
+	if (Format == TSF_RGBA16F)
+	{
+		bool bFits = true;
+		for (int32 Channel = 0; Channel < 4 && bFits; ++Channel)
+		{
+			bFits = FitsIn8Bit(Stats, Channel, bAllowRemap, MaxError, Scale[Channel], Bias[Channel]);
+		}
+
+		if (bFits)
+		{
+			Choice.Format = TSF_BGRA8;
+			Choice.Compression = TC_Default;
+			Choice.Scale = FLinearColor(Scale[0], Scale[1], Scale[2], Scale[3]);
+			Choice.Bias = FLinearColor(Bias[0], Bias[1], Bias[2], Bias[3]);
+		}
+	}
+
+	return Choice;
+}
+
+bool FQuickBakerAnalysis::ConvertPixels(const uint8* Pixels, int64 NumPixels, ETextureSourceFormat Format, const FQuickBakerFormatChoice& Choice, TArray64<uint8>& OutPixels, FQuickBakerCancellationToken& CancellationToken)
+{
+	using namespace QuickBakerAnalysis;
+
+	const int64 NumOutPixels = (int64)Choice.Size.X * Choice.Size.Y;
+	const int32 OutBytesPerPixel = FTextureSource::GetBytesPerPixel(Choice.Format);
+	OutPixels.SetNumUninitialized(NumOutPixels * OutBytesPerPixel);
+	uint8* OutData = OutPixels.GetData();
+
+	// A collapsed constant image repeats its first pixel, whose bytes are already in the right format
+	if (NumOutPixels < NumPixels)
+	{
+		const int32 InBytesPerPixel = FTextureSource::GetBytesPerPixel(Format);
+		for (int64 Index = 0; Index < NumOutPixels; ++Index)
+		{
+			FMemory::Memcpy(OutData + Index * InBytesPerPixel, Pixels, InBytesPerPixel);
+		}
+		return true;
+	}
+
+	const FLinearColor InvScale(1.0f / Choice.Scale.R, 1.0f / Choice.Scale.G, 1.0f / Choice.Scale.B, 1.0f / Choice.Scale.A);
+	auto ToUnorm8 = [&InvScale, &Choice](float Value, int32 Channel)
+	{
+		const float Normalized = (Value - Choice.Bias.Component(Channel)) * InvScale.Component(Channel);
+		return (uint8)FMath::RoundToInt(FMath::Clamp(Normalized, 0.0f, 1.0f) * 255.0f);
+	};
+
+	return CancellationToken.ParallelForRange(NumPixels, [&](int64 Begin, int64 End)
+	{
+		float Values[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		for (int64 Index = Begin; Index < End; ++Index)
+		{
+			ReadPixel(Pixels, Index, Format, Values);
+			switch (Choice.Format)
+			{
+			case TSF_BGRA8:
+				reinterpret_cast<FColor*>(OutData)[Index] = FColor(ToUnorm8(Values[0], 0), ToUnorm8(Values[1], 1), ToUnorm8(Values[2], 2), ToUnorm8(Values[3], 3));
+				break;
+			case TSF_G8:
+				OutData[Index] = ToUnorm8(Values[0], 0);
+				break;
+			case TSF_G16:
+				reinterpret_cast<uint16*>(OutData)[Index] = (uint16)FMath::RoundToInt(FMath::Clamp(Values[0], 0.0f, 1.0f) * 65535.0f);
+				break;
+			case TSF_R16F:
+				reinterpret_cast<FFloat16*>(OutData)[Index] = FFloat16(Values[0]);
+				break;
+			default:
+				break;
+			}
+		}
+	});
+}
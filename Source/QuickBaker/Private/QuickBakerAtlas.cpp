@@ -0,0 +1,528 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerAtlas.h"
+#include "QuickBakerAtlasData.h"
+#include "QuickBakerBakeHistory.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerCore.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerRenderer.h"
+#include "QuickBakerRenderTargetPool.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Editor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/SavePackage.h"
+
+#define LOCTEXT_NAMESPACE "FQuickBakerAtlas"
+
+namespace QuickBakerAtlas
+{
+	/** Suffix of the lookup asset saved next to an atlas texture asset. */
+	static const TCHAR* LookupAssetSuffix = TEXT("_Rects");
+
+	/** Horizontal run of the skyline: the top of the packed rectangles between X and X + Width. */
+	struct FSkylineSegment
+	{
+		int32 X;
+		int32 Y;
+		int32 Width;
+	};
+
+	/**
+	 * Finds the lowest position a rectangle fits on the skyline, leftmost on ties.
+	 *
+	 * @return The segment the rectangle starts on, or INDEX_NONE if it does not fit.
+	 */
+	static int32 FindSkylinePosition(const TArray<FSkylineSegment>& Skyline, const FIntPoint& RectSize, const FIntPoint& AtlasSize, int32& OutY)
+	{
+		int32 BestSegment = INDEX_NONE;
+		int32 BestY = MAX_int32;
+		for (int32 Start = 0; Start < Skyline.Num(); ++Start)
+		{
+			if (Skyline[Start].X + RectSize.X > AtlasSize.X)
+			{
+				break;
+			}
+
+			// The rectangle rests on the highest segment under it
+			int32 Y = 0;
+			int32 CoveredWidth = 0;
+			for (int32 Segment = Start; CoveredWidth < RectSize.X; ++Segment)
+			{
+				Y = FMath::Max(Y, Skyline[Segment].Y);
+				CoveredWidth += Skyline[Segment].Width;
+			}
+
+			if (Y + RectSize.Y <= AtlasSize.Y && Y < BestY)
+			{
+				BestSegment = Start;
+				BestY = Y;
+			}
+		}
+
+		OutY = BestY;
+		return BestSegment;
+	}
+
+	/** Raises the skyline under a rectangle placed at the start of a segment. */
+	static void AddToSkyline(TArray<FSkylineSegment>& Skyline, int32 SegmentIndex, int32 Y, const FIntPoint& RectSize)
+	{
+		const int32 X = Skyline[SegmentIndex].X;
+		Skyline.Insert({ X, Y + RectSize.Y, RectSize.X }, SegmentIndex);
+
+		// Cut the segments now covered by the rectangle
+		const int32 Right = X + RectSize.X;
+		while (SegmentIndex + 1 < Skyline.Num() && Skyline[SegmentIndex + 1].X < Right)
+		{
+			FSkylineSegment& Next = Skyline[SegmentIndex + 1];
+			const int32 NextRight = Next.X + Next.Width;
+			if (NextRight <= Right)
+			{
+				Skyline.RemoveAt(SegmentIndex + 1);
+			}
+			else
+			{
+				Next.Width = NextRight - Right;
+				Next.X = Right;
+				break;
+			}
+		}
+
+		// Merge neighbours of the same height, so later rectangles see one wide segment
+		for (int32 Index = 0; Index + 1 < Skyline.Num();)
+		{
+			if (Skyline[Index].Y == Skyline[Index + 1].Y)
+			{
+				Skyline[Index].Width += Skyline[Index + 1].Width;
+				Skyline.RemoveAt(Index + 1);
+			}
+			else
+			{
+				++Index;
+			}
+		}
+	}
+
+	/** Packs padded rectangles, in the given order, into an atlas of a fixed size. */
+	static bool PackInto(TConstArrayView<FIntPoint> PaddedSizes, TConstArrayView<int32> Order, const FIntPoint& AtlasSize, TArray<FIntPoint>& OutPositions)
+	{
+		TArray<FSkylineSegment> Skyline;
+		Skyline.Add({ 0, 0, AtlasSize.X });
+
+		for (const int32 Index : Order)
+		{
+			int32 Y = 0;
+			const int32 Segment = FindSkylinePosition(Skyline, PaddedSizes[Index], AtlasSize, Y);
+			if (Segment == INDEX_NONE)
+			{
+				return false;
+			}
+
+			OutPositions[Index] = FIntPoint(Skyline[Segment].X, Y);
+			AddToSkyline(Skyline, Segment, Y, PaddedSizes[Index]);
+		}
+		return true;
+	}
+
+	/**
+	 * Doubles the shorter side of an atlas, or the other side once the shorter one is at MaxSize.
+	 *
+	 * @return False if both sides are at MaxSize.
+	 */
+	static bool GrowAtlas(FIntPoint& AtlasSize, int32 MaxSize)
+	{
+		const bool bGrowWidth = AtlasSize.X <= AtlasSize.Y ? AtlasSize.X * 2 <= MaxSize : AtlasSize.Y * 2 > MaxSize;
+		int32& Side = bGrowWidth ? AtlasSize.X : AtlasSize.Y;
+		if (Side * 2 > MaxSize)
+		{
+			return false;
+		}
+		Side *= 2;
+		return true;
+	}
+
+	/** Span of an item draw along one axis: its pixel range and the texture coordinates at both ends. */
+	struct FDrawSpan
+	{
+		double Position;
+		double Length;
+		double UV0;
+		double UV1;
+	};
+
+	/**
+	 * Adds the draws of one item: the item itself with UVs 0-1, and its padding as a clamp to the item's edge.
+	 * The side strips are drawn with the edge pixel's texture coordinate held constant across the strip and the
+	 * corners with the corner pixel's, so every material, procedural or wrap-sampled, repeats its own border
+	 * rather than continuing past it.
+	 */
+	static void AddItemDraws(TArray<FQuickBakerMaterialDraw>& Draws, UMaterialInterface* Material, const FIntPoint& Position, const FIntPoint& Size, int32 Padding)
+	{
+		auto MakeSpans = [Padding](int32 Start, int32 Length)
+		{
+			const double HalfTexel = 0.5 / Length;
+			return TArray<FDrawSpan, TInlineAllocator<3>>
+			{
+				{ (double)Start - Padding, (double)Padding, HalfTexel, HalfTexel },
+				{ (double)Start, (double)Length, 0.0, 1.0 },
+				{ (double)Start + Length, (double)Padding, 1.0 - HalfTexel, 1.0 - HalfTexel }
+			};
+		};
+
+		for (const FDrawSpan& Row : MakeSpans(Position.Y, Size.Y))
+		{
+			for (const FDrawSpan& Column : MakeSpans(Position.X, Size.X))
+			{
+				if (Row.Length <= 0.0 || Column.Length <= 0.0)
+				{
+					continue;
+				}
+
+				FQuickBakerMaterialDraw& Draw = Draws.AddDefaulted_GetRef();
+				Draw.Material = Material;
+				Draw.Position = FVector2D(Column.Position, Row.Position);
+				Draw.Size = FVector2D(Column.Length, Row.Length);
+				Draw.UV0 = FVector2D(Column.UV0, Row.UV0);
+				Draw.UV1 = FVector2D(Column.UV1, Row.UV1);
+			}
+		}
+	}
+
+	/** Gets the texture coordinates of an item's corners. */
+	static void GetItemUVs(const FIntPoint& Position, const FIntPoint& Size, const FIntPoint& AtlasSize, FVector2D& OutUVMin, FVector2D& OutUVMax)
+	{
+		OutUVMin = FVector2D((double)Position.X / AtlasSize.X, (double)Position.Y / AtlasSize.Y);
+		OutUVMax = FVector2D((double)(Position.X + Size.X) / AtlasSize.X, (double)(Position.Y + Size.Y) / AtlasSize.Y);
+	}
+
+	/** Saves the lookup of an atlas texture asset as a UQuickBakerAtlasData asset beside it. */
+	static bool SaveLookupAsset(const FString& TexturePackageName, const FString& TextureName, const FIntPoint& AtlasSize, int32 Padding, TArray<FQuickBakerAtlasEntry> Entries, FString& OutPackageName, FText& OutResultMessage)
+	{
+		const FString AssetName = TextureName + LookupAssetSuffix;
+		OutPackageName = FPaths::GetPath(TexturePackageName) / AssetName;
+
+		UQuickBakerAtlasData* Lookup = nullptr;
+		UObject* Existing = StaticLoadObject(UObject::StaticClass(), nullptr, *(OutPackageName + TEXT(".") + AssetName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+		if (Existing)
+		{
+			Lookup = Cast<UQuickBakerAtlasData>(Existing);
+			if (!Lookup)
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Existing asset %s is a %s, expected QuickBakerAtlasData."), *OutPackageName, *Existing->GetClass()->GetName());
+				OutResultMessage = LOCTEXT("Error_LookupClassMismatch", "An asset of a different type already exists at the atlas lookup path.");
+				return false;
+			}
+		}
+
+		const bool bIsNew = Lookup == nullptr;
+		if (bIsNew)
+		{
+			UPackage* Package = CreatePackage(*OutPackageName);
+			Lookup = Package ? NewObject<UQuickBakerAtlasData>(Package, *AssetName, RF_Public | RF_Standalone) : nullptr;
+			if (!Lookup)
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Failed to create lookup asset %s."), *OutPackageName);
+				OutResultMessage = LOCTEXT("Error_CreateLookup", "Failed to create the atlas lookup asset.");
+				return false;
+			}
+		}
+
+		Lookup->Texture = TSoftObjectPtr<UTexture>(FSoftObjectPath(TexturePackageName + TEXT(".") + TextureName));
+		Lookup->AtlasSize = AtlasSize;
+		Lookup->Padding = Padding;
+		Lookup->Entries = MoveTemp(Entries);
+
+		UPackage* Package = Lookup->GetPackage();
+		Package->MarkPackageDirty();
+		if (bIsNew)
+		{
+			FAssetRegistryModule::AssetCreated(Lookup);
+		}
+
+		const FString PackageFileName = FPackageName::LongPackageNameToFilename(OutPackageName, FPackageName::GetAssetPackageExtension());
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+		SaveArgs.Error = GError;
+
+		if (!UPackage::SavePackage(Package, Lookup, *PackageFileName, SaveArgs))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Failed to save lookup package to %s"), *PackageFileName);
+			OutResultMessage = LOCTEXT("Error_SaveLookup", "Failed to save the atlas lookup asset.");
+			return false;
+		}
+		return true;
+	}
+
+	/** Converts a 2D vector to a JSON array of two numbers. */
+	static TArray<TSharedPtr<FJsonValue>> MakeJsonVector(const FVector2D& Vector)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Add(MakeShared<FJsonValueNumber>(Vector.X));
+		Values.Add(MakeShared<FJsonValueNumber>(Vector.Y));
+		return Values;
+	}
+
+	/** Saves the lookup of an atlas file as JSON: { Width, Height, Padding, Entries: [{ Name, X, Y, Width, Height, UVMin, UVMax }] }. */
+	static bool SaveLookupFile(const FString& FilePath, const FIntPoint& AtlasSize, int32 Padding, TConstArrayView<FQuickBakerAtlasEntry> Entries, FText& OutResultMessage)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("Width"), AtlasSize.X);
+		Root->SetNumberField(TEXT("Height"), AtlasSize.Y);
+		Root->SetNumberField(TEXT("Padding"), Padding);
+
+		TArray<TSharedPtr<FJsonValue>> EntryValues;
+		for (const FQuickBakerAtlasEntry& Entry : Entries)
+		{
+			TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+			Object->SetStringField(TEXT("Name"), Entry.Name.ToString());
+			Object->SetNumberField(TEXT("X"), Entry.Position.X);
+			Object->SetNumberField(TEXT("Y"), Entry.Position.Y);
+			Object->SetNumberField(TEXT("Width"), Entry.Size.X);
+			Object->SetNumberField(TEXT("Height"), Entry.Size.Y);
+			Object->SetArrayField(TEXT("UVMin"), MakeJsonVector(Entry.UVMin));
+			Object->SetArrayField(TEXT("UVMax"), MakeJsonVector(Entry.UVMax));
+			EntryValues.Add(MakeShared<FJsonValueObject>(Object));
+		}
+		Root->SetArrayField(TEXT("Entries"), EntryValues);
+
+		FString Json;
+		FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+		if (!FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Failed to write lookup file %s"), *FilePath);
+			OutResultMessage = LOCTEXT("Error_SaveLookupFile", "Failed to write the atlas lookup file.");
+			return false;
+		}
+		return true;
+	}
+}
+
+using namespace QuickBakerAtlas;
+
+bool FQuickBakerAtlas::Pack(TConstArrayView<FIntPoint> Sizes, int32 Padding, int32 MaxSize, FIntPoint& OutAtlasSize, TArray<FIntPoint>& OutPositions)
+{
+	OutAtlasSize = FIntPoint::ZeroValue;
+	OutPositions.Reset();
+	if (Sizes.Num() == 0)
+	{
+		return false;
+	}
+
+	Padding = FMath::Max(Padding, 0);
+	TArray<FIntPoint> PaddedSizes;
+	PaddedSizes.Reserve(Sizes.Num());
+	FIntPoint LargestSize = FIntPoint::ZeroValue;
+	int64 TotalArea = 0;
+	for (const FIntPoint& Size : Sizes)
+	{
+		const FIntPoint PaddedSize(Size.X + 2 * Padding, Size.Y + 2 * Padding);
+		if (Size.X <= 0 || Size.Y <= 0 || PaddedSize.X > MaxSize || PaddedSize.Y > MaxSize)
+		{
+			return false;
+		}
+		PaddedSizes.Add(PaddedSize);
+		LargestSize = LargestSize.ComponentMax(PaddedSize);
+		TotalArea += (int64)PaddedSize.X * PaddedSize.Y;
+	}
+
+	// Tallest first, then widest, keeps the skyline flat
+	TArray<int32> Order;
+	Order.Reserve(Sizes.Num());
+	for (int32 Index = 0; Index < Sizes.Num(); ++Index)
+	{
+		Order.Add(Index);
+	}
+	Order.StableSort([&PaddedSizes](int32 A, int32 B)
+	{
+		return PaddedSizes[A].Y != PaddedSizes[B].Y ? PaddedSizes[A].Y > PaddedSizes[B].Y : PaddedSizes[A].X > PaddedSizes[B].X;
+	});
+
+	// Start from the smallest power of two holding the largest item and the total area, then grow until everything fits
+	FIntPoint AtlasSize(FMath::RoundUpToPowerOfTwo(LargestSize.X), FMath::RoundUpToPowerOfTwo(LargestSize.Y));
+	while ((int64)AtlasSize.X * AtlasSize.Y < TotalArea)
+	{
+		if (!GrowAtlas(AtlasSize, MaxSize))
+		{
+			return false;
+		}
+	}
+
+	TArray<FIntPoint> PaddedPositions;
+	PaddedPositions.SetNumZeroed(Sizes.Num());
+	while (!PackInto(PaddedSizes, Order, AtlasSize, PaddedPositions))
+	{
+		if (!GrowAtlas(AtlasSize, MaxSize))
+		{
+			return false;
+		}
+	}
+
+	OutAtlasSize = AtlasSize;
+	OutPositions.Reserve(Sizes.Num());
+	for (const FIntPoint& PaddedPosition : PaddedPositions)
+	{
+		OutPositions.Add(PaddedPosition + FIntPoint(Padding, Padding));
+	}
+	return true;
+}
+
+bool FQuickBakerAtlas::Execute(TConstArrayView<FQuickBakerAtlasItem> Items, const FQuickBakerSettings& Settings, int32 Padding, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage)
+{
+	Padding = FMath::Max(Padding, 0);
+
+	// Validate the items and give each a unique name
+	TArray<FIntPoint> Sizes;
+	TArray<FName> Names;
+	TSet<FName> UsedNames;
+	for (const FQuickBakerAtlasItem& Item : Items)
+	{
+		UMaterialInterface* Material = Item.Material.Get();
+		if (!Material || Item.Size.X <= 0 || Item.Size.Y <= 0)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Item %d has no material or an empty size."), Sizes.Num());
+			OutResultMessage = LOCTEXT("Error_InvalidItem", "Every atlas item needs a material and a size.");
+			return false;
+		}
+
+		const FName BaseName = Item.Name.IsNone() ? Material->GetFName() : Item.Name;
+		FName Name = BaseName;
+		for (int32 Suffix = 1; UsedNames.Contains(Name); ++Suffix)
+		{
+			Name = FName(*FString::Printf(TEXT("%s_%d"), *BaseName.ToString(), Suffix));
+		}
+		UsedNames.Add(Name);
+		Names.Add(Name);
+		Sizes.Add(Item.Size);
+	}
+
+	if (Sizes.Num() == 0)
+	{
+		OutResultMessage = LOCTEXT("Error_NoItems", "The atlas has no items.");
+		return false;
+	}
+
+	const double BakeStartTime = FPlatformTime::Seconds();
+	const FQuickBakerHostMemoryScope HostMemory;
+
+	FIntPoint AtlasSize;
+	TArray<FIntPoint> Positions;
+	const int32 MaxDimension = FQuickBakerCore::GetMaxTextureDimension();
+	if (!Pack(Sizes, Padding, MaxDimension, AtlasSize, Positions))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: %d items with %d px padding do not fit a %dx%d atlas."), Sizes.Num(), Padding, MaxDimension, MaxDimension);
+		OutResultMessage = FText::Format(LOCTEXT("Error_AtlasTooLarge", "The items do not fit the maximum supported texture size ({0})."), FText::AsNumber(MaxDimension));
+		return false;
+	}
+
+	// The atlas is one single-mode bake of the whole atlas. Variants would blend neighbouring items, and the
+	// post-process stages would blur, dilate and normalize across them, so both are left out.
+	FQuickBakerSettings AtlasSettings = Settings;
+	AtlasSettings.Width = AtlasSize.X;
+	AtlasSettings.Height = AtlasSize.Y;
+	AtlasSettings.BakeMode = EQuickBakerBakeMode::Single;
+	AtlasSettings.ResolutionVariants.Reset();
+	AtlasSettings.PostProcessStages.Reset();
+	AtlasSettings.SelectedMaterial = Items[0].Material;
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: No valid editor world found."));
+		OutResultMessage = LOCTEXT("Error_NoWorld", "No valid editor world found.");
+		return false;
+	}
+
+	UTextureRenderTarget2D* RenderTarget = FQuickBakerRenderTargetPool::Acquire(AtlasSize.X, AtlasSize.Y, FQuickBakerCore::GetRenderTargetFormat(AtlasSettings));
+	ON_SCOPE_EXIT
+	{
+		FQuickBakerRenderTargetPool::Release(RenderTarget);
+	};
+
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Atlas failed: Failed to create a %dx%d render target."), AtlasSize.X, AtlasSize.Y);
+		OutResultMessage = LOCTEXT("Error_RTCreate", "Failed to create render target.");
+		return false;
+	}
+
+	// Each item also fills its padding with its own clamped edge, so mips and filtering never reach a neighbour
+	TArray<FQuickBakerMaterialDraw> Draws;
+	TArray<FQuickBakerAtlasEntry> Entries;
+	Draws.Reserve(Items.Num() * (Padding > 0 ? 9 : 1));
+	Entries.Reserve(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		const FIntPoint& Position = Positions[Index];
+		const FIntPoint& Size = Sizes[Index];
+		AddItemDraws(Draws, Items[Index].Material.Get(), Position, Size, Padding);
+
+		FQuickBakerAtlasEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Name = Names[Index];
+		Entry.Position = Position;
+		Entry.Size = Size;
+		GetItemUVs(Position, Size, AtlasSize, Entry.UVMin, Entry.UVMax);
+	}
+
+	if (!FQuickBakerRenderer::DrawMaterials(World, RenderTarget, Draws))
+	{
+		OutResultMessage = LOCTEXT("Error_Draw", "Failed to draw the atlas items.");
+		return false;
+	}
+
+	if (CancellationToken.ShouldCancel())
+	{
+		return false;
+	}
+
+	// One readback and one save for every item
+	bool bSuccess = FQuickBakerCore::SaveRenderTarget(RenderTarget, AtlasSettings, CancellationToken, OutResultMessage);
+	if (bSuccess)
+	{
+		FText LookupMessage;
+		FString LookupPath;
+		if (AtlasSettings.OutputType == EQuickBakerOutputType::Asset)
+		{
+			bSuccess = SaveLookupAsset(FQuickBakerCore::GetAssetPackageName(AtlasSettings), AtlasSettings.OutputName, AtlasSize, Padding, Entries, LookupPath, LookupMessage);
+		}
+		else
+		{
+			LookupPath = FPaths::ChangeExtension(AtlasSettings.GetOutputFilePath(), TEXT("json"));
+			bSuccess = SaveLookupFile(LookupPath, AtlasSize, Padding, Entries, LookupMessage);
+		}
+
+		OutResultMessage = bSuccess
+			? FText::Format(LOCTEXT("Success_Atlas", "{0}\nAtlas: {1} items in {2}x{3}\nLookup: {4}"),
+				OutResultMessage, FText::AsNumber(Entries.Num()), FText::AsNumber(AtlasSize.X), FText::AsNumber(AtlasSize.Y), FText::FromString(LookupPath))
+			: LookupMessage;
+	}
+
+	if (!CancellationToken.IsCanceled())
+	{
+		FQuickBakerBakeRecord Record = FQuickBakerBakeRecord::FromSettings(AtlasSettings, TEXT("Atlas"));
+		Record.bSuccess = bSuccess;
+		Record.TotalSeconds = FPlatformTime::Seconds() - BakeStartTime;
+		Record.HostBytes = HostMemory.GetGrowth();
+		Record.GPUBytes = FQuickBakerRenderTargetPool::GetTargetBytes(RenderTarget);
+		Record.OutputBytes = bSuccess ? FQuickBakerBakeHistory::GetOutputBytes(AtlasSettings) : 0;
+		FQuickBakerBakeHistory::Append(Record);
+	}
+
+	if (bSuccess)
+	{
+		UE_LOG(LogQuickBaker, Log, TEXT("Atlas success: %d items packed into %dx%d."), Entries.Num(), AtlasSize.X, AtlasSize.Y);
+	}
+	return bSuccess;
+}
+
+#undef LOCTEXT_NAMESPACE
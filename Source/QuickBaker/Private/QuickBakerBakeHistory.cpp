@@ -0,0 +1,300 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerBakeHistory.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerJobFile.h"
+#include "Algo/Reverse.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace QuickBakerBakeHistory
+{
+	/** Host memory scopes that are open, in the order they were opened. */
+	static TArray<FQuickBakerHostMemoryScope*> OpenHostMemoryScopes;
+
+	/** Converts a record to a single-line JSON object. */
+	static FString RecordToLine(const FQuickBakerBakeRecord& Record)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Timestamp"), Record.Timestamp.ToIso8601());
+		Object->SetStringField(TEXT("Source"), Record.Source);
+		Object->SetStringField(TEXT("Material"), Record.Material);
+		Object->SetStringField(TEXT("OutputName"), Record.OutputName);
+		Object->SetStringField(TEXT("OutputType"), Record.OutputType);
+		Object->SetStringField(TEXT("BakeMode"), Record.BakeMode);
+		Object->SetNumberField(TEXT("Width"), Record.Width);
+		Object->SetNumberField(TEXT("Height"), Record.Height);
+		Object->SetNumberField(TEXT("NumPixels"), (double)Record.NumPixels);
+		Object->SetNumberField(TEXT("NumVariants"), Record.NumVariants);
+		Object->SetNumberField(TEXT("NumPostProcessStages"), Record.NumPostProcessStages);
+		Object->SetBoolField(TEXT("Success"), Record.bSuccess);
+		Object->SetNumberField(TEXT("SetupSeconds"), Record.SetupSeconds);
+		Object->SetNumberField(TEXT("DrawSeconds"), Record.DrawSeconds);
+		Object->SetNumberField(TEXT("SaveSeconds"), Record.SaveSeconds);
+		Object->SetNumberField(TEXT("TotalSeconds"), Record.TotalSeconds);
+		Object->SetNumberField(TEXT("MegapixelsPerSecond"), Record.GetMegapixelsPerSecond());
+		Object->SetNumberField(TEXT("HostBytes"), (double)Record.HostBytes);
+		Object->SetNumberField(TEXT("GPUBytes"), (double)Record.GPUBytes);
+		Object->SetNumberField(TEXT("OutputBytes"), (double)Record.OutputBytes);
+		Object->SetNumberField(TEXT("PoolHits"), Record.PoolHits);
+		Object->SetNumberField(TEXT("PoolMisses"), Record.PoolMisses);
+		Object->SetBoolField(TEXT("SkippedUnchanged"), Record.bSkippedUnchanged);
+
+		FString Line;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+		FJsonSerializer::Serialize(Object, Writer);
+		return Line;
+	}
+
+	/** Reads a record from one line. */
+	static bool LineToRecord(const FString& Line, FQuickBakerBakeRecord& OutRecord)
+	{
+		TSharedPtr<FJsonObject> Object;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Object) || !Object.IsValid())
+		{
+			return false;
+		}
+
+		FString Timestamp;
+		if (!Object->TryGetStringField(TEXT("Timestamp"), Timestamp) || !FDateTime::ParseIso8601(*Timestamp, OutRecord.Timestamp))
+		{
+			return false;
+		}
+
+		Object->TryGetStringField(TEXT("Source"), OutRecord.Source);
+		Object->TryGetStringField(TEXT("Material"), OutRecord.Material);
+		Object->TryGetStringField(TEXT("OutputName"), OutRecord.OutputName);
+		Object->TryGetStringField(TEXT("OutputType"), OutRecord.OutputType);
+		Object->TryGetStringField(TEXT("BakeMode"), OutRecord.BakeMode);
+		Object->TryGetNumberField(TEXT("Width"), OutRecord.Width);
+		Object->TryGetNumberField(TEXT("Height"), OutRecord.Height);
+		Object->TryGetNumberField(TEXT("NumPixels"), OutRecord.NumPixels);
+		Object->TryGetNumberField(TEXT("NumVariants"), OutRecord.NumVariants);
+		Object->TryGetNumberField(TEXT("NumPostProcessStages"), OutRecord.NumPostProcessStages);
+		Object->TryGetBoolField(TEXT("Success"), OutRecord.bSuccess);
+		Object->TryGetNumberField(TEXT("SetupSeconds"), OutRecord.SetupSeconds);
+		Object->TryGetNumberField(TEXT("DrawSeconds"), OutRecord.DrawSeconds);
+		Object->TryGetNumberField(TEXT("SaveSeconds"), OutRecord.SaveSeconds);
+		Object->TryGetNumberField(TEXT("TotalSeconds"), OutRecord.TotalSeconds);
+		Object->TryGetNumberField(TEXT("HostBytes"), OutRecord.HostBytes);
+		Object->TryGetNumberField(TEXT("GPUBytes"), OutRecord.GPUBytes);
+		Object->TryGetNumberField(TEXT("OutputBytes"), OutRecord.OutputBytes);
+		Object->TryGetNumberField(TEXT("PoolHits"), OutRecord.PoolHits);
+		Object->TryGetNumberField(TEXT("PoolMisses"), OutRecord.PoolMisses);
+		Object->TryGetBoolField(TEXT("SkippedUnchanged"), OutRecord.bSkippedUnchanged);
+		return true;
+	}
+
+	/** Adds the files a bake with these settings writes, without its variants. */
+	static void GetOutputFiles(const FQuickBakerSettings& Settings, TArray<FString>& OutFiles)
+	{
+		if (Settings.OutputType == EQuickBakerOutputType::Asset)
+		{
+			FString PackageFilename;
+			const FString PackageName = FPaths::Combine(Settings.OutputPath, Settings.OutputName);
+			if (FPackageName::TryConvertLongPackageNameToFilename(PackageName, PackageFilename, FPackageName::GetAssetPackageExtension()))
+			{
+				OutFiles.Add(PackageFilename);
+			}
+		}
+		else if (Settings.BakeMode == EQuickBakerBakeMode::UDIM)
+		{
+			const TCHAR* Extension = FQuickBakerSettings::GetFileExtension(Settings.OutputType);
+			for (int32 TileIndex = 0; TileIndex < Settings.GetUDIMTileCount(); ++TileIndex)
+			{
+				OutFiles.Add(FPaths::Combine(Settings.OutputPath, FString::Printf(TEXT("%s.%d.%s"), *Settings.OutputName, Settings.GetUDIMTileNumber(TileIndex), Extension)));
+			}
+		}
+		else
+		{
+			OutFiles.Add(Settings.GetOutputFilePath());
+		}
+	}
+
+	/** Gets the median of a list of values, reordering it. */
+	static double GetMedian(TArray<double>& Values)
+	{
+		if (Values.Num() == 0)
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		const int32 Middle = Values.Num() / 2;
+		return (Values.Num() % 2) ? Values[Middle] : 0.5 * (Values[Middle - 1] + Values[Middle]);
+	}
+}
+
+using namespace QuickBakerBakeHistory;
+
+FQuickBakerBakeRecord FQuickBakerBakeRecord::FromSettings(const FQuickBakerSettings& Settings, const FString& InSource)
+{
+	FQuickBakerBakeRecord Record;
+	Record.Timestamp = FDateTime::UtcNow();
+	Record.Source = InSource;
+	Record.Material = Settings.SelectedMaterial.IsValid() ? Settings.SelectedMaterial->GetPathName() : FString();
+	Record.OutputName = Settings.OutputName;
+	Record.OutputType = FQuickBakerJobFile::GetOutputTypeName(Settings.OutputType);
+	Record.BakeMode = FQuickBakerJobFile::GetBakeModeName(Settings.BakeMode);
+	Record.Width = Settings.Width;
+	Record.Height = Settings.Height;
+
+	const FIntPoint OutputSize = Settings.GetOutputSize();
+	const int32 NumTiles = (Settings.BakeMode == EQuickBakerBakeMode::UDIM) ? Settings.GetUDIMTileCount() : 1;
+	Record.NumPixels = (int64)OutputSize.X * OutputSize.Y * NumTiles;
+	Record.NumVariants = Settings.GetResolutionVariantSizes().Num();
+	Record.NumPostProcessStages = Settings.PostProcessStages.Num();
+	return Record;
+}
+
+FQuickBakerHostMemoryScope::FQuickBakerHostMemoryScope()
+{
+	check(IsInGameThread());
+	StartBytes = FPlatformMemory::GetStats().UsedPhysical;
+	PeakBytes = StartBytes;
+	QuickBakerBakeHistory::OpenHostMemoryScopes.Add(this);
+}
+
+FQuickBakerHostMemoryScope::~FQuickBakerHostMemoryScope()
+{
+	check(IsInGameThread());
+	QuickBakerBakeHistory::OpenHostMemoryScopes.RemoveSingle(this);
+}
+
+void FQuickBakerHostMemoryScope::Sample()
+{
+	check(IsInGameThread());
+	if (QuickBakerBakeHistory::OpenHostMemoryScopes.IsEmpty())
+	{
+		return;
+	}
+
+	const uint64 UsedBytes = FPlatformMemory::GetStats().UsedPhysical;
+	for (FQuickBakerHostMemoryScope* Scope : QuickBakerBakeHistory::OpenHostMemoryScopes)
+	{
+		Scope->PeakBytes = FMath::Max(Scope->PeakBytes, UsedBytes);
+	}
+}
+
+int64 FQuickBakerHostMemoryScope::GetGrowth() const
+{
+	return (int64)(PeakBytes - StartBytes);
+}
+
+FString FQuickBakerBakeHistory::GetHistoryFilePath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("QuickBaker"), TEXT("BakeHistory.jsonl")));
+}
+
+bool FQuickBakerBakeHistory::Append(const FQuickBakerBakeRecord& Record)
+{
+	// One short append per record; several worker processes may share the file
+	const FString Line = RecordToLine(Record) + TEXT("\n");
+	if (!FFileHelper::SaveStringToFile(Line, *GetHistoryFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogQuickBaker, Warning, TEXT("FQuickBakerBakeHistory::Append failed: Could not write %s."), *GetHistoryFilePath());
+		return false;
+	}
+	return true;
+}
+
+TArray<FQuickBakerBakeRecord> FQuickBakerBakeHistory::Load(int32 MaxRecords)
+{
+	TArray<FQuickBakerBakeRecord> Records;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetHistoryFilePath()))
+	{
+		return Records;
+	}
+
+	const int32 FirstLine = FMath::Max(0, Lines.Num() - MaxRecords);
+	Records.Reserve(Lines.Num() - FirstLine);
+	for (int32 LineIndex = FirstLine; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		FQuickBakerBakeRecord Record;
+		if (LineToRecord(Lines[LineIndex], Record))
+		{
+			Records.Add(MoveTemp(Record));
+		}
+	}
+	return Records;
+}
+
+int64 FQuickBakerBakeHistory::GetOutputBytes(const FQuickBakerSettings& Settings)
+{
+	TArray<FString> Files;
+	GetOutputFiles(Settings, Files);
+	for (const FIntPoint& VariantSize : Settings.GetResolutionVariantSizes())
+	{
+		GetOutputFiles(Settings.GetVariantSettings(VariantSize), Files);
+	}
+
+	int64 TotalBytes = 0;
+	for (const FString& File : Files)
+	{
+		TotalBytes += FMath::Max<int64>(IFileManager::Get().FileSize(*File), 0);
+	}
+	return TotalBytes;
+}
+
+TArray<FQuickBakerBakeRecord> FQuickBakerBakeHistory::GetMaterialTrend(TConstArrayView<FQuickBakerBakeRecord> Records, const FString& Material, int32 MaxRecords)
+{
+	TArray<FQuickBakerBakeRecord> Trend;
+	for (int32 Index = Records.Num() - 1; Index >= 0 && Trend.Num() < MaxRecords; --Index)
+	{
+		if (Records[Index].bSuccess && Records[Index].Material == Material)
+		{
+			Trend.Add(Records[Index]);
+		}
+	}
+	Algo::Reverse(Trend);
+	return Trend;
+}
+
+TArray<FQuickBakerMaterialSummary> FQuickBakerBakeHistory::GetSlowestMaterials(TConstArrayView<FQuickBakerBakeRecord> Records, int32 MaxMaterials)
+{
+	// Throughput rather than time, so that large bakes do not crowd out materials that are expensive per pixel
+	TMap<FString, TArray<const FQuickBakerBakeRecord*>> RecordsByMaterial;
+	for (const FQuickBakerBakeRecord& Record : Records)
+	{
+		if (Record.bSuccess && !Record.Material.IsEmpty() && Record.TotalSeconds > 0.0)
+		{
+			RecordsByMaterial.FindOrAdd(Record.Material).Add(&Record);
+		}
+	}
+
+	TArray<FQuickBakerMaterialSummary> Summaries;
+	for (const TPair<FString, TArray<const FQuickBakerBakeRecord*>>& Pair : RecordsByMaterial)
+	{
+		TArray<double> Throughputs;
+		TArray<double> Seconds;
+		for (const FQuickBakerBakeRecord* Record : Pair.Value)
+		{
+			Throughputs.Add(Record->GetMegapixelsPerSecond());
+			Seconds.Add(Record->TotalSeconds);
+		}
+
+		FQuickBakerMaterialSummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.Material = Pair.Key;
+		Summary.NumBakes = Pair.Value.Num();
+		Summary.LatestMegapixelsPerSecond = Pair.Value.Last()->GetMegapixelsPerSecond();
+		Summary.MedianMegapixelsPerSecond = GetMedian(Throughputs);
+		Summary.MedianSeconds = GetMedian(Seconds);
+	}
+
+	Summaries.Sort([](const FQuickBakerMaterialSummary& A, const FQuickBakerMaterialSummary& B)
+	{
+		return A.MedianMegapixelsPerSecond < B.MedianMegapixelsPerSecond;
+	});
+	if (Summaries.Num() > MaxMaterials)
+	{
+		Summaries.SetNum(MaxMaterials);
+	}
+	return Summaries;
+}
@@ -0,0 +1,385 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerBatch.h"
+#include "QuickBakerBakeHistory.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerCore.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerReadback.h"
+#include "QuickBakerRenderer.h"
+#include "QuickBakerRenderTargetPool.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Editor.h"
+#include "RenderingThread.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+
+namespace QuickBakerBatch
+{
+	/** Time the game thread sleeps while every busy slot is waiting on the GPU or a worker. */
+	static constexpr float StallSleepSeconds = 0.001f;
+
+	/** Stage of the job held by a slot. */
+	enum class ESlotStage : uint8
+	{
+		Free,      /**< Available for the next job */
+		Rendering, /**< Draw queued; waiting for the GPU to finish the draw and the copy */
+		Encoding   /**< Pixels on the CPU; a worker encodes and writes them */
+	};
+
+	/** One job in flight, with the buffers it keeps between jobs. */
+	struct FSlot
+	{
+		ESlotStage Stage = ESlotStage::Free;
+		int32 JobIndex = INDEX_NONE;
+
+		/** Time the job was submitted. */
+		double StartTime = 0.0;
+
+		/** Host memory growth of the job, open from submission to saved. */
+		TOptional<FQuickBakerHostMemoryScope> HostMemory;
+
+		/** True if the job's pixels come through Readback; false if its save reads the render target itself. */
+		bool bAsyncReadback = false;
+
+		UTextureRenderTarget2D* RenderTarget = nullptr;
+		TArray<UTextureRenderTarget2D*> VariantTargets;
+
+		/** Staging copy and CPU pixels, reused by every job of this slot. */
+		FQuickBakerAsyncReadback Readback;
+		TArray64<uint8> Pixels;
+
+		TFuture<bool> Encode;
+
+		/** Worker time of the last encode. Written by the worker, read once Encode is ready. */
+		double EncodeSeconds = 0.0;
+	};
+
+	/** Gets whether a job can be read back through the ring: a file of one image or flipbook, without variants. */
+	static bool CanReadBackAsync(const FQuickBakerSettings& Settings)
+	{
+		return Settings.OutputType != EQuickBakerOutputType::Asset
+			&& (Settings.BakeMode == EQuickBakerBakeMode::Single || Settings.BakeMode == EQuickBakerBakeMode::Flipbook)
+			&& Settings.GetResolutionVariantSizes().IsEmpty();
+	}
+
+	/** Returns the slot's render targets to the pool and frees the slot. */
+	static void ReleaseSlot(FSlot& Slot)
+	{
+		FQuickBakerRenderTargetPool::Release(Slot.RenderTarget);
+		for (UTextureRenderTarget2D* VariantTarget : Slot.VariantTargets)
+		{
+			FQuickBakerRenderTargetPool::Release(VariantTarget);
+		}
+
+		Slot.RenderTarget = nullptr;
+		Slot.VariantTargets.Reset();
+		Slot.Stage = ESlotStage::Free;
+		Slot.JobIndex = INDEX_NONE;
+	}
+
+	/**
+	 * Acquires the job's render targets and queues its draw, followed by the post-process chain, the variant
+	 * downsamples and, for ring readbacks, the copy to the staging buffer. UDIM jobs draw tile by tile in their save.
+	 */
+	static bool SubmitJob(FSlot& Slot, const FQuickBakerSettings& Settings, UWorld* World)
+	{
+		const FIntPoint OutputSize = Settings.GetOutputSize();
+		if (FMath::Max(OutputSize.X, OutputSize.Y) > FQuickBakerCore::GetMaxTextureDimension())
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed: Resolution exceeds the maximum supported texture dimension."), *Settings.OutputName);
+			return false;
+		}
+
+		const ETextureRenderTargetFormat Format = FQuickBakerCore::GetRenderTargetFormat(Settings);
+		Slot.RenderTarget = FQuickBakerRenderTargetPool::Acquire(OutputSize.X, OutputSize.Y, Format);
+		if (!Slot.RenderTarget)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed: Failed to create render target."), *Settings.OutputName);
+			return false;
+		}
+
+		Slot.bAsyncReadback = false;
+		if (Settings.BakeMode == EQuickBakerBakeMode::UDIM)
+		{
+			return true;
+		}
+
+		const FIntPoint Grid = Settings.GetCellGrid();
+		for (const FIntPoint& VariantSize : Settings.GetResolutionVariantSizes())
+		{
+			UTextureRenderTarget2D* VariantTarget = FQuickBakerRenderTargetPool::Acquire(VariantSize.X * Grid.X, VariantSize.Y * Grid.Y, Format);
+			if (!VariantTarget)
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed: Failed to create render target for the %dx%d variant."), *Settings.OutputName, VariantSize.X, VariantSize.Y);
+				return false;
+			}
+			Slot.VariantTargets.Add(VariantTarget);
+		}
+
+		FQuickBakerGraphPasses AfterDraw = FQuickBakerCore::MakeBakePasses(Settings, Slot.VariantTargets);
+
+		Slot.bAsyncReadback = CanReadBackAsync(Settings);
+		if (Slot.bAsyncReadback)
+		{
+			const int32 BytesPerPixel = Settings.UsesFloatPixels() ? sizeof(FFloat16Color) : sizeof(FColor);
+			Slot.Pixels.SetNumUninitialized((int64)OutputSize.X * OutputSize.Y * BytesPerPixel, EAllowShrinking::No);
+
+			AfterDraw = [BakePasses = MoveTemp(AfterDraw), CopyPasses = Slot.Readback.Begin(OutputSize, BytesPerPixel, Slot.Pixels.GetData())](FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)
+			{
+				if (BakePasses)
+				{
+					BakePasses(GraphBuilder, BakeTarget);
+				}
+				CopyPasses(GraphBuilder, BakeTarget);
+			};
+		}
+
+		const bool bDrawn = (Settings.BakeMode == EQuickBakerBakeMode::Single)
+			? FQuickBakerRenderer::DrawMaterial(World, Slot.RenderTarget, Settings.SelectedMaterial.Get(), MoveTemp(AfterDraw))
+			: FQuickBakerCore::DrawMaterialCells(World, Slot.RenderTarget, Settings, MoveTemp(AfterDraw));
+		if (!bDrawn)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed: Could not draw the material."), *Settings.OutputName);
+			if (Slot.bAsyncReadback)
+			{
+				Slot.Readback.Reset();
+			}
+		}
+		return bDrawn;
+	}
+
+	/** Hands read-back pixels to a worker that converts, encodes and writes them. */
+	static void StartEncode(FSlot& Slot, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken)
+	{
+		FSlot* SlotPtr = &Slot;
+		const FIntPoint Size = Settings.GetOutputSize();
+		const bool bIsFloat = Settings.UsesFloatPixels();
+		const EPixelFormat PixelFormat = Slot.Readback.GetPixelFormat();
+		const EQuickBakerOutputType OutputType = Settings.OutputType;
+		const FString FullPath = Settings.GetOutputFilePath();
+
+		Slot.Stage = ESlotStage::Encoding;
+		Slot.Encode = Async(EAsyncExecution::ThreadPool, [SlotPtr, Size, bIsFloat, PixelFormat, OutputType, FullPath, &CancellationToken]()
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const bool bSuccess = FQuickBakerReadback::ConvertToColorPixels(SlotPtr->Pixels.GetData(), (int64)Size.X * Size.Y, PixelFormat)
+				&& FQuickBakerExporter::ExportPixelsToFile(SlotPtr->Pixels.GetData(), Size.X, Size.Y, bIsFloat, FullPath, OutputType, &CancellationToken);
+			SlotPtr->EncodeSeconds = FPlatformTime::Seconds() - StartTime;
+			return bSuccess;
+		});
+	}
+}
+
+FString FQuickBakerBatchStats::ToString() const
+{
+	return FString::Printf(
+		TEXT("%d of %d jobs saved in %.2f s (%.1f jobs/s, %d failed) with %d slots. Average jobs rendering %.2f, encoding %.2f. ")
+		TEXT("Game thread: submit %.2f s, synchronous saves %.2f s (%d jobs), stalled %.2f s in %d waits. Worker encode %.2f s."),
+		NumSucceeded, NumJobs, TotalSeconds, GetJobsPerSecond(), NumFailed, NumSlots, AverageRendering, AverageEncoding,
+		SubmitSeconds, SyncSaveSeconds, NumSyncReadbacks, StallSeconds, NumStalls, EncodeSeconds);
+}
+
+bool FQuickBakerBatch::Execute(TConstArrayView<FQuickBakerSettings> Jobs, FQuickBakerCancellationToken& CancellationToken, FQuickBakerBatchStats& OutStats, int32 NumSlots, const FQuickBakerBatchJobFinished& OnJobFinished)
+{
+	using namespace QuickBakerBatch;
+	check(IsInGameThread());
+
+	OutStats = FQuickBakerBatchStats();
+	OutStats.NumJobs = Jobs.Num();
+	OutStats.NumSlots = FMath::Clamp(NumSlots, 1, 4);
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Batch failed: No valid editor world found."));
+		OutStats.NumFailed = Jobs.Num();
+		return false;
+	}
+
+	// Worker threads must not load modules, so the encoder module is loaded before the first job is handed off
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	// Slots are heap-allocated so workers and render commands can hold on to them
+	TArray<TUniquePtr<FSlot>> Slots;
+	for (int32 SlotIndex = 0; SlotIndex < OutStats.NumSlots; ++SlotIndex)
+	{
+		Slots.Add(MakeUnique<FSlot>());
+	}
+
+	auto FinishJob = [&OutStats, &Jobs, &CancellationToken, &OnJobFinished](FSlot& Slot, bool bSuccess)
+	{
+		const int32 JobIndex = Slot.JobIndex;
+		const double Seconds = FPlatformTime::Seconds() - Slot.StartTime;
+		const int64 HostBytes = Slot.HostMemory.IsSet() ? Slot.HostMemory->GetGrowth() : 0;
+		Slot.HostMemory.Reset();
+
+		int64 GPUBytes = Slot.RenderTarget ? FQuickBakerRenderTargetPool::GetTargetBytes(Slot.RenderTarget) : 0;
+		for (const UTextureRenderTarget2D* VariantTarget : Slot.VariantTargets)
+		{
+			GPUBytes += FQuickBakerRenderTargetPool::GetTargetBytes(VariantTarget);
+		}
+		ReleaseSlot(Slot);
+
+		if (!bSuccess && CancellationToken.IsCanceled())
+		{
+			return;
+		}
+
+		// Jobs overlap, so a batch record only has the job's own time from submission to saved
+		FQuickBakerBakeRecord Record = FQuickBakerBakeRecord::FromSettings(Jobs[JobIndex], TEXT("Batch"));
+		Record.bSuccess = bSuccess;
+		Record.TotalSeconds = Seconds;
+		Record.HostBytes = HostBytes;
+		Record.GPUBytes = GPUBytes;
+		Record.OutputBytes = bSuccess ? FQuickBakerBakeHistory::GetOutputBytes(Jobs[JobIndex]) : 0;
+		FQuickBakerBakeHistory::Append(Record);
+
+		if (bSuccess)
+		{
+			++OutStats.NumSucceeded;
+		}
+		else
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed."), *Jobs[JobIndex].OutputName);
+			++OutStats.NumFailed;
+		}
+
+		if (OnJobFinished)
+		{
+			OnJobFinished(JobIndex, bSuccess, Seconds);
+		}
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+	double LastSampleTime = StartTime;
+	bool bWasStalled = false;
+	int32 NextJob = 0;
+
+	while (!CancellationToken.ShouldCancel())
+	{
+		// Occupancy is weighted by the time each slot spent in its stage since the last iteration
+		const double Now = FPlatformTime::Seconds();
+		int32 NumBusy = 0;
+		for (const TUniquePtr<FSlot>& Slot : Slots)
+		{
+			OutStats.AverageRendering += (Slot->Stage == ESlotStage::Rendering) ? Now - LastSampleTime : 0.0;
+			OutStats.AverageEncoding += (Slot->Stage == ESlotStage::Encoding) ? Now - LastSampleTime : 0.0;
+			NumBusy += (Slot->Stage != ESlotStage::Free) ? 1 : 0;
+		}
+		LastSampleTime = Now;
+
+		if (NumBusy == 0 && NextJob == Jobs.Num())
+		{
+			break;
+		}
+
+		bool bProgress = false;
+
+		// Hand each job on to its next stage as soon as the previous one finished
+		for (const TUniquePtr<FSlot>& SlotPtr : Slots)
+		{
+			FSlot& Slot = *SlotPtr;
+			if (Slot.Stage == ESlotStage::Free)
+			{
+				continue;
+			}
+
+			const FQuickBakerSettings& Settings = Jobs[Slot.JobIndex];
+			if (Slot.Stage == ESlotStage::Rendering && !Slot.bAsyncReadback)
+			{
+				// Read back and saved on the game thread; the draws already queued for other slots keep the GPU busy
+				const double SaveStartTime = FPlatformTime::Seconds();
+				FText ResultMessage;
+				const bool bSuccess = (Settings.BakeMode == EQuickBakerBakeMode::UDIM)
+					? FQuickBakerCore::BakeUDIMTiles(World, Slot.RenderTarget, Settings, CancellationToken, ResultMessage)
+					: FQuickBakerCore::SaveRenderTargets(Slot.RenderTarget, Slot.VariantTargets, Settings, CancellationToken, ResultMessage);
+				OutStats.SyncSaveSeconds += FPlatformTime::Seconds() - SaveStartTime;
+				++OutStats.NumSyncReadbacks;
+				FinishJob(Slot, bSuccess);
+				bProgress = true;
+			}
+			else if (Slot.Stage == ESlotStage::Rendering && Slot.Readback.Poll())
+			{
+				StartEncode(Slot, Settings, CancellationToken);
+				bProgress = true;
+			}
+			else if (Slot.Stage == ESlotStage::Rendering && Slot.Readback.HasFailed())
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("Batch job %s failed: Could not read back the render target."), *Settings.OutputName);
+				FinishJob(Slot, false);
+				bProgress = true;
+			}
+			else if (Slot.Stage == ESlotStage::Encoding && Slot.Encode.IsReady())
+			{
+				OutStats.EncodeSeconds += Slot.EncodeSeconds;
+				FinishJob(Slot, Slot.Encode.Consume());
+				bProgress = true;
+			}
+		}
+
+		// Refill free slots, so the GPU already works on the next jobs while earlier ones read back and encode
+		for (const TUniquePtr<FSlot>& SlotPtr : Slots)
+		{
+			FSlot& Slot = *SlotPtr;
+			while (Slot.Stage == ESlotStage::Free && NextJob < Jobs.Num())
+			{
+				const double SubmitStartTime = FPlatformTime::Seconds();
+				Slot.JobIndex = NextJob++;
+				Slot.StartTime = SubmitStartTime;
+				Slot.HostMemory.Emplace();
+				const FQuickBakerSettings& Settings = Jobs[Slot.JobIndex];
+				if (Settings.IsValid() && SubmitJob(Slot, Settings, World))
+				{
+					Slot.Stage = ESlotStage::Rendering;
+				}
+				else
+				{
+					FinishJob(Slot, false);
+				}
+				OutStats.SubmitSeconds += FPlatformTime::Seconds() - SubmitStartTime;
+				bProgress = true;
+			}
+		}
+
+		if (!bProgress)
+		{
+			// Every busy slot waits on the GPU or a worker
+			const double StallStartTime = FPlatformTime::Seconds();
+			OutStats.NumStalls += bWasStalled ? 0 : 1;
+			FPlatformProcess::SleepNoStats(StallSleepSeconds);
+			OutStats.StallSeconds += FPlatformTime::Seconds() - StallStartTime;
+		}
+		bWasStalled = !bProgress;
+	}
+
+	// A cancel leaves jobs in flight: workers stop through the token, and queued copies must run before the slots go
+	for (const TUniquePtr<FSlot>& Slot : Slots)
+	{
+		if (Slot->Stage == ESlotStage::Encoding)
+		{
+			Slot->Encode.Wait();
+		}
+	}
+	FlushRenderingCommands();
+	for (const TUniquePtr<FSlot>& Slot : Slots)
+	{
+		if (Slot->Stage != ESlotStage::Free)
+		{
+			ReleaseSlot(*Slot);
+		}
+	}
+
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats.TotalSeconds > 0.0)
+	{
+		OutStats.AverageRendering /= OutStats.TotalSeconds;
+		OutStats.AverageEncoding /= OutStats.TotalSeconds;
+	}
+
+	UE_LOG(LogQuickBaker, Log, TEXT("Batch %s: %s"), CancellationToken.IsCanceled() ? TEXT("canceled") : TEXT("finished"), *OutStats.ToString());
+	return OutStats.NumSucceeded == Jobs.Num();
+}
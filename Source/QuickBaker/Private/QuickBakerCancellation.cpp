@@ -0,0 +1,85 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerCancellation.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace QuickBakerCancellation
+{
+	/** Minimum time between progress dialog polls. Polling pumps Slate, so it is kept off the per-block fast path. */
+	static constexpr double PollIntervalSeconds = 0.02;
+
+	/** Pixels processed between two cancellation checks (a 2k image is four blocks). */
+	static constexpr int64 PixelsPerBlock = 1 << 20;
+
+	/** Pixels handed to one parallel task within a block. */
+	static constexpr int64 PixelsPerChunk = 1 << 14;
+}
+
+FQuickBakerCancellationToken::FQuickBakerCancellationToken(FScopedSlowTask* InSlowTask)
+	: SlowTask(InSlowTask)
+	, bCanceled(false)
+	, LastPollTime(0.0)
+{
+}
+
+void FQuickBakerCancellationToken::Cancel()
+{
+	bCanceled.store(true, std::memory_order_relaxed);
+}
+
+bool FQuickBakerCancellationToken::IsCanceled() const
+{
+	return bCanceled.load(std::memory_order_relaxed);
+}
+
+bool FQuickBakerCancellationToken::ShouldCancel()
+{
+	if (IsCanceled())
+	{
+		return true;
+	}
+
+	if (SlowTask && IsInGameThread())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastPollTime >= QuickBakerCancellation::PollIntervalSeconds)
+		{
+			LastPollTime = Now;
+			if (SlowTask->ShouldCancel())
+			{
+				Cancel();
+			}
+		}
+	}
+
+	return IsCanceled();
+}
+
+bool FQuickBakerCancellationToken::ParallelForRange(int64 Num, TFunctionRef<void(int64 Begin, int64 End)> Body, int64 ElementCost)
+{
+	using namespace QuickBakerCancellation;
+
+	const int64 Cost = FMath::Max<int64>(ElementCost, 1);
+	const int64 BlockSize = FMath::Max<int64>(PixelsPerBlock / Cost, 1);
+	const int64 ChunkSize = FMath::Max<int64>(PixelsPerChunk / Cost, 1);
+
+	for (int64 BlockBegin = 0; BlockBegin < Num; BlockBegin += BlockSize)
+	{
+		if (ShouldCancel())
+		{
+			return false;
+		}
+
+		const int64 BlockEnd = FMath::Min(BlockBegin + BlockSize, Num);
+		const int32 NumChunks = (int32)FMath::DivideAndRoundUp(BlockEnd - BlockBegin, ChunkSize);
+		ParallelFor(NumChunks, [&Body, BlockBegin, BlockEnd, ChunkSize](int32 ChunkIndex)
+		{
+			const int64 Begin = BlockBegin + ChunkIndex * ChunkSize;
+			Body(Begin, FMath::Min(Begin + ChunkSize, BlockEnd));
+		});
+	}
+
+	return !ShouldCancel();
+}
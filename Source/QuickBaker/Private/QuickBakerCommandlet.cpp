@@ -0,0 +1,118 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerCommandlet.h"
+#include "QuickBakerAtlas.h"
+#include "QuickBakerBatch.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerDistributed.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerJobFile.h"
+#include "UObject/StrongObjectPtr.h"
+
+UQuickBakerCommandlet::UQuickBakerCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UQuickBakerCommandlet::Main(const FString& Params)
+{
+	FString JobFilePath;
+	if (!FParse::Value(*Params, TEXT("Jobs="), JobFilePath))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("QuickBaker commandlet: Missing -Jobs=<File>."));
+		return 1;
+	}
+
+	int32 NumSlots = FQuickBakerBatch::DefaultNumSlots;
+	FParse::Value(*Params, TEXT("Slots="), NumSlots);
+
+	// Worker started by a coordinator
+	FString CoordinatorAddress;
+	if (FParse::Value(*Params, TEXT("Coordinator="), CoordinatorAddress))
+	{
+		int32 WorkerId = 0;
+		FParse::Value(*Params, TEXT("Worker="), WorkerId);
+		return FQuickBakerDistributed::RunWorker(JobFilePath, CoordinatorAddress, WorkerId, NumSlots) ? 0 : 1;
+	}
+
+	TArray<FQuickBakerSettings> Jobs;
+	if (!FQuickBakerJobFile::Load(JobFilePath, Jobs))
+	{
+		return 1;
+	}
+
+	// The settings only hold weak pointers, so the materials are kept alive here; a coordinator writes their paths
+	// into every shard, including those of retries
+	TArray<TStrongObjectPtr<UMaterialInterface>> Materials;
+	for (const FQuickBakerSettings& Settings : Jobs)
+	{
+		if (Settings.SelectedMaterial.IsValid())
+		{
+			Materials.Emplace(Settings.SelectedMaterial.Get());
+		}
+	}
+
+	FQuickBakerCancellationToken CancellationToken;
+
+	// One atlas of every job's material
+	if (FParse::Param(*Params, TEXT("Atlas")))
+	{
+		if (Jobs.Num() == 0)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("QuickBaker commandlet: The job file has no jobs to pack into an atlas."));
+			return 1;
+		}
+
+		TArray<FQuickBakerAtlasItem> Items;
+		for (const FQuickBakerSettings& Settings : Jobs)
+		{
+			FQuickBakerAtlasItem& Item = Items.AddDefaulted_GetRef();
+			Item.Material = Settings.SelectedMaterial;
+			Item.Size = FIntPoint(Settings.Width, Settings.Height);
+			Item.Name = FName(*Settings.OutputName);
+		}
+
+		FQuickBakerSettings AtlasSettings = Jobs[0];
+		AtlasSettings.OutputName = TEXT("T_Atlas");
+		FParse::Value(*Params, TEXT("AtlasName="), AtlasSettings.OutputName);
+
+		int32 Padding = FQuickBakerAtlas::DefaultPadding;
+		FParse::Value(*Params, TEXT("Padding="), Padding);
+
+		FText ResultMessage;
+		const bool bSuccess = FQuickBakerAtlas::Execute(Items, AtlasSettings, Padding, CancellationToken, ResultMessage);
+		UE_LOG(LogQuickBaker, Log, TEXT("Atlas %s: %s"), bSuccess ? TEXT("finished") : TEXT("failed"), *ResultMessage.ToString());
+		return bSuccess ? 0 : 1;
+	}
+
+	// Coordinator of several workers
+	int32 NumWorkers = 0;
+	if (FParse::Value(*Params, TEXT("Workers="), NumWorkers) && NumWorkers > 0)
+	{
+		FQuickBakerDistributedOptions Options;
+		Options.NumWorkers = NumWorkers;
+		Options.NumSlotsPerWorker = NumSlots;
+		FParse::Value(*Params, TEXT("Retries="), Options.MaxRetries);
+		FParse::Value(*Params, TEXT("WorkerTimeout="), Options.WorkerTimeoutSeconds);
+		FParse::Value(*Params, TEXT("WorkDir="), Options.WorkDirectory);
+		FParse::Value(*Params, TEXT("Address="), Options.CoordinatorAddress);
+		FParse::Value(*Params, TEXT("Port="), Options.Port);
+
+		FString Nodes;
+		if (FParse::Value(*Params, TEXT("Nodes="), Nodes))
+		{
+			Nodes.ParseIntoArray(Options.NodeLaunchCommands, TEXT(";"));
+		}
+
+		FQuickBakerDistributedStats Stats;
+		return FQuickBakerDistributed::Execute(Jobs, Options, CancellationToken, Stats) ? 0 : 1;
+	}
+
+	// Everything in this process
+	FQuickBakerBatchStats Stats;
+	return FQuickBakerBatch::Execute(Jobs, CancellationToken, Stats, NumSlots) ? 0 : 1;
+}
@@ -1,10 +1,20 @@
 // Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
 
 #include "QuickBakerCore.h"
+#include "QuickBakerAnalysis.h"
+#include "QuickBakerBakeHistory.h"
+#include "QuickBakerCancellation.h"
 #include "QuickBakerExporter.h"
+#include "QuickBakerOutputProfile.h"
+#include "QuickBakerReadback.h"
+#include "QuickBakerRenderer.h"
+#include "QuickBakerRenderTargetPool.h"
+#include "QuickBakerTextureUpdateQueue.h"
+#include "QuickBakerUtils.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/Texture2D.h"
-#include "Kismet/KismetRenderingLibrary.h"
+#include "Engine/TextureCube.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopeExit.h"
@@ -15,181 +25,1269 @@
 #include "Misc/Paths.h"
 #include "Misc/PackageName.h"
 #include "RenderingThread.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
 #include "UObject/SavePackage.h"
+#include "UObject/MetaData.h"
 #include "TextureResource.h"
 #include "RHI.h"
 #include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Memory/SharedBuffer.h"
+#include "Serialization/EditorBulkData.h"
+#include <atomic>
 
 #define LOCTEXT_NAMESPACE "FQuickBakerCore"
 
+/** Number of asset saves skipped as unchanged since startup, compared before and after a bake for its history record. */
+static int32 NumUnchangedSaveSkips = 0;
+
+/**
+ * Builds the graph passes running the bake's post-process chain on the render target, or nullptr if it has none.
+ * Every cell of the target (flipbook frame, cube face, UDIM tile) is Width x Height pixels.
+ */
+static FQuickBakerGraphPasses MakePostProcessPasses(const FQuickBakerSettings& Settings)
+{
+	if (Settings.PostProcessStages.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FIntPoint CellSize(Settings.Width, Settings.Height);
+	return [Stages = Settings.PostProcessStages, CellSize](FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)
+	{
+		FQuickBakerPostProcess::AddPasses(GraphBuilder, BakeTarget, Stages, CellSize);
+	};
+}
+
+FQuickBakerGraphPasses FQuickBakerCore::MakeBakePasses(const FQuickBakerSettings& Settings, TConstArrayView<UTextureRenderTarget2D*> VariantTargets)
+{
+	FQuickBakerGraphPasses PostProcessPasses = MakePostProcessPasses(Settings);
+	if (VariantTargets.IsEmpty())
+	{
+		return PostProcessPasses;
+	}
+
+	TArray<FTextureRenderTargetResource*> VariantResources;
+	for (UTextureRenderTarget2D* VariantTarget : VariantTargets)
+	{
+		if (FTextureRenderTargetResource* VariantResource = VariantTarget->GameThread_GetRenderTargetResource())
+		{
+			VariantResources.Add(VariantResource);
+		}
+	}
+
+	return [PostProcessPasses = MoveTemp(PostProcessPasses), VariantResources = MoveTemp(VariantResources)](FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)
+	{
+		if (PostProcessPasses)
+		{
+			PostProcessPasses(GraphBuilder, BakeTarget);
+		}
+
+		for (FTextureRenderTargetResource* VariantResource : VariantResources)
+		{
+			FRDGTextureRef VariantTarget = RegisterExternalTexture(GraphBuilder, VariantResource->GetRenderTargetTexture(), TEXT("QuickBakerVariant"));
+			FQuickBakerPostProcess::AddDownsamplePasses(GraphBuilder, BakeTarget, VariantTarget);
+		}
+	};
+}
+
+/**
+ * Copies the cells of a grid-laid-out image into consecutive texture slices, in cell order
+ * (e.g. cube faces drawn 3x2 into the six slices of a Texture Cube source).
+ * Returns false if the bake was canceled part way.
+ */
+static bool CopyCellsToSlices(const uint8* SrcData, uint8* DstData, const FIntPoint& ImageSize, const FIntPoint& Grid, int32 NumSlices, int32 BytesPerPixel, FQuickBakerCancellationToken& CancellationToken)
+{
+	const int32 CellWidth = ImageSize.X / Grid.X;
+	const int32 CellHeight = ImageSize.Y / Grid.Y;
+	const int64 CellRowBytes = (int64)CellWidth * BytesPerPixel;
+
+	return CancellationToken.ParallelForRange((int64)NumSlices * CellHeight, [=](int64 BeginRow, int64 EndRow)
+	{
+		for (int64 DstRow = BeginRow; DstRow < EndRow; ++DstRow)
+		{
+			const int64 Slice = DstRow / CellHeight;
+			const int64 CellY = DstRow % CellHeight;
+			const int64 SrcY = (Slice / Grid.X) * CellHeight + CellY;
+			const int64 SrcX = (Slice % Grid.X) * CellWidth;
+			FMemory::Memcpy(DstData + DstRow * CellRowBytes, SrcData + (SrcY * ImageSize.X + SrcX) * BytesPerPixel, CellRowBytes);
+		}
+	}, CellWidth);
+}
+
+/**
+ * Compares freshly baked pixels against an existing texture source mip.
+ * With a zero tolerance this is a parallel memcmp; otherwise every channel may differ by up to Tolerance
+ * (in 0-1 units for normalized formats, absolute for float formats).
+ */
+static bool MatchesSourcePixels(const uint8* OldData, const uint8* NewData, int64 NumBytes, ETextureSourceFormat Format, float Tolerance)
+{
+	constexpr int64 ChunkBytes = 1 << 20;
+	const int32 NumChunks = (int32)FMath::DivideAndRoundUp(NumBytes, ChunkBytes);
+	std::atomic<bool> bDifferent(false);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		if (bDifferent.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		const int64 Begin = ChunkIndex * ChunkBytes;
+		const int64 Count = FMath::Min(ChunkBytes, NumBytes - Begin);
+		const uint8* Old = OldData + Begin;
+		const uint8* New = NewData + Begin;
+		bool bChunkDifferent = false;
+
+		if (Tolerance <= 0.0f)
+		{
+			bChunkDifferent = FMemory::Memcmp(Old, New, Count) != 0;
+		}
+		else
+		{
+			// Chunk boundaries are a power of two, so they never split a channel
+			switch (Format)
+			{
+			case TSF_BGRA8:
+			case TSF_G8:
+			{
+				const int32 MaxDelta = FMath::FloorToInt32(Tolerance * 255.0f);
+				for (int64 Index = 0; Index < Count && !bChunkDifferent; ++Index)
+				{
+					bChunkDifferent = FMath::Abs((int32)Old[Index] - (int32)New[Index]) > MaxDelta;
+				}
+				break;
+			}
+			case TSF_G16:
+			{
+				const int32 MaxDelta = FMath::FloorToInt32(Tolerance * 65535.0f);
+				const uint16* OldValues = reinterpret_cast<const uint16*>(Old);
+				const uint16* NewValues = reinterpret_cast<const uint16*>(New);
+				for (int64 Index = 0; Index < Count / 2 && !bChunkDifferent; ++Index)
+				{
+					bChunkDifferent = FMath::Abs((int32)OldValues[Index] - (int32)NewValues[Index]) > MaxDelta;
+				}
+				break;
+			}
+			case TSF_RGBA16F:
+			case TSF_R16F:
+			{
+				const FFloat16* OldValues = reinterpret_cast<const FFloat16*>(Old);
+				const FFloat16* NewValues = reinterpret_cast<const FFloat16*>(New);
+				for (int64 Index = 0; Index < Count / 2 && !bChunkDifferent; ++Index)
+				{
+					bChunkDifferent = !(FMath::Abs(OldValues[Index].GetFloat() - NewValues[Index].GetFloat()) <= Tolerance);
+				}
+				break;
+			}
+			case TSF_R32F:
+			{
+				const float* OldValues = reinterpret_cast<const float*>(Old);
+				const float* NewValues = reinterpret_cast<const float*>(New);
+				for (int64 Index = 0; Index < Count / 4 && !bChunkDifferent; ++Index)
+				{
+					bChunkDifferent = !(FMath::Abs(OldValues[Index] - NewValues[Index]) <= Tolerance);
+				}
+				break;
+			}
+			default:
+				bChunkDifferent = FMemory::Memcmp(Old, New, Count) != 0;
+				break;
+			}
+		}
+
+		if (bChunkDifferent)
+		{
+			bDifferent.store(true, std::memory_order_relaxed);
+		}
+	});
+
+	return !bDifferent.load();
+}
+
+/** Package metadata keys holding the mapping from stored values back to baked values after a range remap. */
+static const FName RangeScaleKey(TEXT("QuickBaker.RangeScale"));
+static const FName RangeBiasKey(TEXT("QuickBaker.RangeBias"));
+static const FName ConstantAlphaKey(TEXT("QuickBaker.ConstantAlpha"));
+
+/** Formats a format choice's remap as the metadata values written by SetRangeRemapMetaData (empty if not remapped). */
+static void GetRangeRemapValues(const FQuickBakerFormatChoice& Choice, FString& OutScale, FString& OutBias)
+{
+	OutScale = Choice.IsRemapped() ? Choice.Scale.ToString() : FString();
+	OutBias = Choice.IsRemapped() ? Choice.Bias.ToString() : FString();
+}
+
+/** Returns true if the texture's package metadata already describes the remap of Choice. */
+static bool MatchesRangeRemapMetaData(UTexture* Texture, const FQuickBakerFormatChoice& Choice)
+{
+	UMetaData* MetaData = Texture->GetPackage()->GetMetaData();
+	FString Scale, Bias;
+	GetRangeRemapValues(Choice, Scale, Bias);
+	return MetaData->GetValue(Texture, RangeScaleKey) == Scale && MetaData->GetValue(Texture, RangeBiasKey) == Bias;
+}
+
+/** Stores the remap of Choice as package metadata on the texture, or removes stale keys if it is not remapped. */
+static void SetRangeRemapMetaData(UTexture* Texture, const FQuickBakerFormatChoice& Choice, bool bDroppedAlpha)
+{
+	UMetaData* MetaData = Texture->GetPackage()->GetMetaData();
+	FString Scale, Bias;
+	GetRangeRemapValues(Choice, Scale, Bias);
+	if (Choice.IsRemapped())
+	{
+		MetaData->SetValue(Texture, RangeScaleKey, *Scale);
+		MetaData->SetValue(Texture, RangeBiasKey, *Bias);
+	}
+	else
+	{
+		MetaData->RemoveValue(Texture, RangeScaleKey);
+		MetaData->RemoveValue(Texture, RangeBiasKey);
+	}
+
+	if (bDroppedAlpha)
+	{
+		MetaData->SetValue(Texture, ConstantAlphaKey, *FString::SanitizeFloat(Choice.ConstantAlpha));
+	}
+	else
+	{
+		MetaData->RemoveValue(Texture, ConstantAlphaKey);
+	}
+}
+
+/**
+ * Applies the output rule matching a bake to its texture and logs the projected runtime memory per platform.
+ * Returns the report for the result message, or an empty string if no platform could be projected.
+ */
+static FString ApplyOutputRule(const FQuickBakerSettings& Settings, UTexture* Texture, const FIntPoint& Size, int32 NumSlices, const FString& FullPackageName)
+{
+	FQuickBakerOutputRule Rule;
+	const bool bHasRule = FQuickBakerOutputProfile::FindRule(Settings, Size, Rule);
+	FQuickBakerOutputProfile::Apply(bHasRule ? &Rule : nullptr, Texture);
+
+	// UDIM textures are only sampled as a whole through virtual texturing, whatever the rule says
+	if (Settings.BakeMode == EQuickBakerBakeMode::UDIM)
+	{
+		Texture->VirtualTextureStreaming = true;
+	}
+
+	const TArray<FQuickBakerPlatformMemory> Memory = FQuickBakerOutputProfile::ProjectRuntimeMemory(Texture, Size, NumSlices, bHasRule ? (int64)Rule.MaxMemoryKB * 1024 : 0);
+	const FString RuleName = bHasRule ? Rule.Name : TEXT("(none)");
+	UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: %s uses output rule %s. Projected runtime memory:"), *FullPackageName, *RuleName);
+	for (const FQuickBakerPlatformMemory& Entry : Memory)
+	{
+		const FString Line = FQuickBakerOutputProfile::FormatMemoryReport(MakeArrayView(&Entry, 1));
+		if (Entry.bOverBudget)
+		{
+			UE_LOG(LogQuickBaker, Warning, TEXT("BakeToAsset: %s: %s"), *FullPackageName, *Line);
+		}
+		else
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: %s: %s"), *FullPackageName, *Line);
+		}
+	}
+
+	return Memory.IsEmpty() ? FString() : FString::Printf(TEXT("Output rule: %s\n%s"), *RuleName, *FQuickBakerOutputProfile::FormatMemoryReport(Memory));
+}
+
+/**
+ * PNG-encodes texture source pixels on a worker thread, for storage as compressed texture source.
+ * The game thread keeps polling the progress dialog meanwhile; the encoder itself cannot be interrupted,
+ * so a cancel takes effect as soon as it returns. Returns false if encoding failed or the bake was canceled.
+ */
+static bool CompressSourcePNG(const uint8* Pixels, const FIntPoint& Size, ETextureSourceFormat Format, TArray64<uint8>& OutCompressed, FQuickBakerCancellationToken& CancellationToken)
+{
+	const ERGBFormat RGBFormat = (Format == TSF_BGRA8) ? ERGBFormat::BGRA : ERGBFormat::Gray;
+	const int32 BitDepth = (Format == TSF_G16) ? 16 : 8;
+	const int64 NumBytes = (int64)Size.X * Size.Y * FTextureSource::GetBytesPerPixel(Format);
+
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+	if (!ImageWrapper.IsValid() || !ImageWrapper->SetRaw(Pixels, NumBytes, Size.X, Size.Y, RGBFormat, BitDepth))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Could not prepare PNG source compression."));
+		return false;
+	}
+
+	TFuture<TArray64<uint8>> Encoded = Async(EAsyncExecution::ThreadPool, [ImageWrapper]()
+	{
+		return ImageWrapper->GetCompressed();
+	});
+
+	while (!Encoded.WaitFor(FTimespan::FromMilliseconds(20.0)))
+	{
+		CancellationToken.ShouldCancel();
+	}
+
+	OutCompressed = Encoded.Consume();
+	if (OutCompressed.Num() == 0)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: PNG source compression produced no data."));
+		return false;
+	}
+
+	return !CancellationToken.ShouldCancel();
+}
+
 void FQuickBakerCore::ExecuteBake(const FQuickBakerSettings& Settings)
 {
 	bool bSuccess = false;
 	FText ResultMessage;
 
-	// Scoped block: progress bar is destroyed when this block exits, before any dialog is shown
+	// Scoped block: progress bar is destroyed when this block exits, before any dialog is shown
+	{
+		FScopedSlowTask Task(4.0f, LOCTEXT("BakingTexture", "Baking Texture..."));
+		Task.MakeDialog(true);
+
+		// Polled inside the long loops of every stage, so Cancel takes effect mid-stage rather than at the next phase
+		FQuickBakerCancellationToken CancellationToken(&Task);
+
+		// Every finished bake, successful or not, leaves a performance record. Canceled bakes are left out, since
+		// their timings are not comparable.
+		FQuickBakerBakeRecord Record = FQuickBakerBakeRecord::FromSettings(Settings, TEXT("Editor"));
+		int32 PoolHitsBefore = 0;
+		int32 PoolMissesBefore = 0;
+		FQuickBakerRenderTargetPool::GetCounters(PoolHitsBefore, PoolMissesBefore);
+		const int32 UnchangedSaveSkipsBefore = NumUnchangedSaveSkips;
+		const double BakeStartTime = FPlatformTime::Seconds();
+		double PhaseStartTime = BakeStartTime;
+		const FQuickBakerHostMemoryScope HostMemory;
+
+		ON_SCOPE_EXIT
+		{
+			if (CancellationToken.IsCanceled())
+			{
+				return;
+			}
+
+			int32 PoolHitsAfter = 0;
+			int32 PoolMissesAfter = 0;
+			FQuickBakerRenderTargetPool::GetCounters(PoolHitsAfter, PoolMissesAfter);
+
+			Record.bSuccess = bSuccess;
+			Record.TotalSeconds = FPlatformTime::Seconds() - BakeStartTime;
+			Record.HostBytes = HostMemory.GetGrowth();
+			Record.OutputBytes = bSuccess ? FQuickBakerBakeHistory::GetOutputBytes(Settings) : 0;
+			Record.PoolHits = PoolHitsAfter - PoolHitsBefore;
+			Record.PoolMisses = PoolMissesAfter - PoolMissesBefore;
+			Record.bSkippedUnchanged = NumUnchangedSaveSkips != UnchangedSaveSkipsBefore;
+			FQuickBakerBakeHistory::Append(Record);
+		};
+
+		// Phase 1: Render Target Setup
+		Task.EnterProgressFrame(1.0f, LOCTEXT("SetupRT", "Setting up Render Target..."));
+		if (CancellationToken.ShouldCancel())
+		{
+			return;
+		}
+
+		const ETextureRenderTargetFormat Format = GetRenderTargetFormat(Settings);
+
+		// Flipbooks and cubemaps pack every cell into one texture, so validate the whole grid rather than a single cell
+		const FIntPoint OutputSize = Settings.GetOutputSize();
+
+		// Validate resolution does not exceed GPU hardware limit
+		{
+			const int32 MaxDimension = GetMaxTextureDimension();
+			const int32 LargestDimension = FMath::Max(OutputSize.X, OutputSize.Y);
+			if (LargestDimension > MaxDimension)
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Resolution %d exceeds maximum supported texture dimension %d."), LargestDimension, MaxDimension);
+				FMessageDialog::Open(EAppMsgType::Ok, FText::Format(
+					LOCTEXT("Error_ResolutionExceedsMax", "Resolution {0} exceeds the maximum supported texture dimension ({1})."),
+					FText::AsNumber(LargestDimension),
+					FText::AsNumber(MaxDimension)));
+				return;
+			}
+		}
+
+		// Setup Render Target
+		// Pooled targets stay rooted (GC protected) until released, and are reused by later bakes of the same size.
+		UTextureRenderTarget2D* RenderTarget = FQuickBakerRenderTargetPool::Acquire(OutputSize.X, OutputSize.Y, Format);
+
+		// Ensure the render target goes back to the pool when the function exits (even if early return occurs).
+		ON_SCOPE_EXIT
+		{
+			FQuickBakerRenderTargetPool::Release(RenderTarget);
+		};
+
+		if (!RenderTarget)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Failed to create render target."));
+			ResultMessage = LOCTEXT("Error_RTCreate", "Failed to create render target.");
+			FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+			return;
+		}
+		Record.GPUBytes = FQuickBakerRenderTargetPool::GetTargetBytes(RenderTarget);
+
+		// Phase 2: Material Rendering
+		Task.EnterProgressFrame(2.0f, LOCTEXT("Rendering", "Rendering Material..."));
+		if (CancellationToken.ShouldCancel())
+		{
+			return;
+		}
+
+		UWorld* World = nullptr;
+		if (GEditor)
+		{
+			World = GEditor->GetEditorWorldContext().World();
+		}
+
+		if (!World)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: No valid editor world found."));
+			ResultMessage = LOCTEXT("Error_NoWorld", "No valid editor world found.");
+			FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+			return;
+		}
+
+		if (Settings.BakeMode == EQuickBakerBakeMode::UDIM)
+		{
+			// Tiles are rendered and saved one after another, so both happen within the rendering phase
+			Record.SetupSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+			PhaseStartTime = FPlatformTime::Seconds();
+			bSuccess = BakeUDIMTiles(World, RenderTarget, Settings, CancellationToken, ResultMessage);
+			Record.SaveSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+			Task.EnterProgressFrame(1.0f, LOCTEXT("Saving", "Saving..."));
+		}
+		else
+		{
+			// Resolution variants share the render: they are downsampled from the finished target in the same graph
+			const TArray<FIntPoint> VariantSizes = Settings.GetResolutionVariantSizes();
+			TArray<UTextureRenderTarget2D*> VariantTargets;
+			ON_SCOPE_EXIT
+			{
+				for (UTextureRenderTarget2D* VariantTarget : VariantTargets)
+				{
+					FQuickBakerRenderTargetPool::Release(VariantTarget);
+				}
+			};
+
+			const FIntPoint Grid = Settings.GetCellGrid();
+			for (const FIntPoint& VariantSize : VariantSizes)
+			{
+				UTextureRenderTarget2D* VariantTarget = FQuickBakerRenderTargetPool::Acquire(VariantSize.X * Grid.X, VariantSize.Y * Grid.Y, Format);
+				if (!VariantTarget)
+				{
+					UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Failed to create render target for the %dx%d variant."), VariantSize.X, VariantSize.Y);
+					ResultMessage = LOCTEXT("Error_RTCreate", "Failed to create render target.");
+					FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+					return;
+				}
+				VariantTargets.Add(VariantTarget);
+				Record.GPUBytes += FQuickBakerRenderTargetPool::GetTargetBytes(VariantTarget);
+			}
+
+			Record.SetupSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+			PhaseStartTime = FPlatformTime::Seconds();
+
+			FQuickBakerGraphPasses AfterDraw = MakeBakePasses(Settings, VariantTargets);
+
+			if (Settings.BakeMode == EQuickBakerBakeMode::Single)
+			{
+				if (!FQuickBakerRenderer::DrawMaterial(World, RenderTarget, Settings.SelectedMaterial.Get(), MoveTemp(AfterDraw)))
+				{
+					ResultMessage = LOCTEXT("Error_Draw", "Failed to draw the material.");
+					FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+					return;
+				}
+			}
+			else if (!DrawMaterialCells(World, RenderTarget, Settings, MoveTemp(AfterDraw)))
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Could not draw flipbook frames or cubemap faces."));
+				ResultMessage = LOCTEXT("Error_DrawCells", "Failed to draw flipbook frames or cubemap faces.");
+				FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+				return;
+			}
+
+			// No flush here: the draw is only queued, and the readback in BakeToAsset / ExportToFile is queued behind it
+			// on the render thread, so its single flush waits for both.
+			Record.DrawSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+
+			// Phase 3: Save
+			Task.EnterProgressFrame(1.0f, LOCTEXT("Saving", "Saving..."));
+			if (CancellationToken.ShouldCancel())
+			{
+				return;
+			}
+
+			PhaseStartTime = FPlatformTime::Seconds();
+			bSuccess = SaveRenderTargets(RenderTarget, VariantTargets, Settings, CancellationToken, ResultMessage);
+			Record.SaveSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+		}
+
+		// A canceled bake ends like the phase-boundary cancels above: no result dialog
+		if (!bSuccess && CancellationToken.IsCanceled())
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("ExecuteBake canceled."));
+			return;
+		}
+	} // FScopedSlowTask is destroyed here — progress bar reaches 100% and closes
+
+	// Show result dialog after the progress bar has fully completed
+	FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
+}
+
+bool FQuickBakerCore::SaveRenderTarget(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage)
+{
+	if (Settings.OutputType == EQuickBakerOutputType::Asset)
+	{
+		return BakeToAsset(RenderTarget, Settings, CancellationToken, OutResultMessage);
+	}
+
+	// External Export
+	const FString FullPath = Settings.GetOutputFilePath();
+
+	// Cubemaps are exported as an equirectangular image, since the image formats have no cube layout
+	const bool bSuccess = (Settings.BakeMode == EQuickBakerBakeMode::Cubemap)
+		? FQuickBakerExporter::ExportCubemapToFile(RenderTarget, FullPath, Settings.OutputType, &CancellationToken)
+		: FQuickBakerExporter::ExportToFile(RenderTarget, FullPath, Settings.OutputType, &CancellationToken);
+	if (bSuccess)
+	{
+		UE_LOG(LogQuickBaker, Log, TEXT("ExecuteBake success: Saved to %s"), *FullPath);
+		OutResultMessage = FText::Format(LOCTEXT("Success_Export", "Saved to {0}"), FText::FromString(FullPath));
+	}
+	else if (!CancellationToken.IsCanceled())
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Failed to save file to disk or convert image at %s"), *FullPath);
+		OutResultMessage = LOCTEXT("Error_SaveFile", "Failed to save file to disk or convert image.");
+	}
+	return bSuccess;
+}
+
+bool FQuickBakerCore::SaveRenderTargets(UTextureRenderTarget2D* RenderTarget, TConstArrayView<UTextureRenderTarget2D*> VariantTargets, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage)
+{
+	if (!SaveRenderTarget(RenderTarget, Settings, CancellationToken, OutResultMessage))
+	{
+		return false;
+	}
+
+	// Variants go through the same save path, one after another, once the main output is done
+	const TArray<FIntPoint> VariantSizes = Settings.GetResolutionVariantSizes();
+	check(VariantSizes.Num() == VariantTargets.Num());
+	for (int32 VariantIndex = 0; VariantIndex < VariantSizes.Num(); ++VariantIndex)
+	{
+		// The main output's message is kept unless a variant fails
+		FText VariantMessage;
+		if (!SaveRenderTarget(VariantTargets[VariantIndex], Settings.GetVariantSettings(VariantSizes[VariantIndex]), CancellationToken, VariantMessage))
+		{
+			OutResultMessage = VariantMessage;
+			return false;
+		}
+	}
+
+	if (VariantSizes.Num() > 0)
+	{
+		OutResultMessage = FText::Format(LOCTEXT("Success_Variants", "{0}\nAlso saved {1} smaller resolution variants."), OutResultMessage, FText::AsNumber(VariantSizes.Num()));
+	}
+	return true;
+}
+
+bool FQuickBakerCore::DrawMaterialCells(UWorld* World, UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerGraphPasses AfterDraw)
+{
+	UMaterialInterface* Material = Settings.SelectedMaterial.Get();
+	if (!Material)
+	{
+		return false;
+	}
+
+	const bool bIsCubemap = Settings.BakeMode == EQuickBakerBakeMode::Cubemap;
+	const FIntPoint Grid = Settings.GetCellGrid();
+	const int32 CellCount = bIsCubemap ? 6 : Settings.FlipbookFrameCount;
+
+	// One instance per cell: the canvas batches every tile and renders them together in one pass,
+	// so re-parameterizing a single instance between draws would give every cell the last cell's parameters.
+	TArray<UMaterialInstanceDynamic*> CellMaterials;
+	CellMaterials.Reserve(CellCount);
+
+	// GC Protection: cell instances must survive until the draw is queued. Their render proxies are released
+	// by later rendering commands, so they outlive the queued draw even if the instances are collected.
+	ON_SCOPE_EXIT
+	{
+		for (UMaterialInstanceDynamic* CellMaterial : CellMaterials)
+		{
+			CellMaterial->RemoveFromRoot();
+		}
+	};
+
+	const FString CubeFacePrefix = Settings.CubeFaceParameterPrefix.ToString();
+	const FName ForwardParameter(*(CubeFacePrefix + TEXT("Forward")));
+	const FName RightParameter(*(CubeFacePrefix + TEXT("Right")));
+	const FName DownParameter(*(CubeFacePrefix + TEXT("Down")));
+
+	for (int32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+	{
+		UMaterialInstanceDynamic* CellMaterial = UMaterialInstanceDynamic::Create(Material, GetTransientPackage());
+		if (!CellMaterial)
+		{
+			return false;
+		}
+		CellMaterial->AddToRoot();
+		CellMaterials.Add(CellMaterial);
+
+		if (bIsCubemap)
+		{
+			FVector Forward, Right, Down;
+			FQuickBakerUtils::GetCubeFaceBasis(CellIndex, Forward, Right, Down);
+			CellMaterial->SetVectorParameterValue(ForwardParameter, FLinearColor(Forward));
+			CellMaterial->SetVectorParameterValue(RightParameter, FLinearColor(Right));
+			CellMaterial->SetVectorParameterValue(DownParameter, FLinearColor(Down));
+		}
+		else
+		{
+			const float FrameTime = Settings.FlipbookDuration * CellIndex / CellCount;
+			CellMaterial->SetScalarParameterValue(Settings.TimeParameterName, FrameTime);
+		}
+	}
+
+	// Draw every cell into its own grid slot, left to right, top to bottom
+	TArray<FQuickBakerMaterialDraw> Draws;
+	Draws.SetNum(CellCount);
+	const FVector2D CellSize((double)RenderTarget->SizeX / Grid.X, (double)RenderTarget->SizeY / Grid.Y);
+	for (int32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+	{
+		const int32 Column = CellIndex % Grid.X;
+		const int32 Row = CellIndex / Grid.X;
+		Draws[CellIndex].Material = CellMaterials[CellIndex];
+		Draws[CellIndex].Position = FVector2D(Column * CellSize.X, Row * CellSize.Y);
+		Draws[CellIndex].Size = CellSize;
+	}
+
+	// Submits all cells and the caller's passes in one graph; the caller's readback waits for them once.
+	return FQuickBakerRenderer::DrawMaterials(World, RenderTarget, Draws, MoveTemp(AfterDraw));
+}
+
+int32 FQuickBakerCore::GetMaxTextureDimension()
+{
+	// GMaxTextureDimensions is a TRHIGlobal<int32> from RHI.h (linked via RHI module)
+	const int32 RHIMax = static_cast<int32>(GMaxTextureDimensions);
+	return (RHIMax > 0) ? RHIMax : 16384; // Fallback if RHI not yet initialized
+}
+
+ETextureRenderTargetFormat FQuickBakerCore::GetRenderTargetFormat(const FQuickBakerSettings& Settings)
+{
+	if (Settings.OutputType == EQuickBakerOutputType::Asset)
+	{
+		// Assets that only need one or two channels use a narrower target (see GetAssetFormats)
+		ETextureRenderTargetFormat Format;
+		ETextureSourceFormat SourceFormat;
+		GetAssetFormats(Settings, Format, SourceFormat);
+		return Format;
+	}
+
+	// Files are read back as FColor or FFloat16Color, matching the pixel layout of the output format
+	return Settings.UsesFloatPixels() ? RTF_RGBA16f : RTF_RGBA8;
+}
+
+void FQuickBakerCore::GetAssetFormats(const FQuickBakerSettings& Settings, ETextureRenderTargetFormat& OutRenderTargetFormat, ETextureSourceFormat& OutSourceFormat)
+{
+	const bool bIs16Bit = Settings.BitDepth == EQuickBakerBitDepth::Bit16;
+
+	switch (Settings.Compression)
+	{
+	case TC_Grayscale:
+		// Only one channel survives compression. 16-bit keeps the half floats as they are, since a unorm source
+		// would clamp signed data such as distance fields and add no precision; the analysis narrows [0, 1] data.
+		OutRenderTargetFormat = bIs16Bit ? RTF_R16f : RTF_R8;
+		OutSourceFormat = bIs16Bit ? TSF_R16F : TSF_G8;
+		break;
+	case TC_HalfFloat:
+		OutRenderTargetFormat = RTF_R16f;
+		OutSourceFormat = TSF_R16F;
+		break;
+	case TC_SingleFloat:
+		OutRenderTargetFormat = RTF_R32f;
+		OutSourceFormat = TSF_R32F;
+		break;
+	case TC_Normalmap:
+		// BC5 keeps only X and Y. There is no two-channel source format, so Z is reconstructed on readback.
+		OutRenderTargetFormat = bIs16Bit ? RTF_RG16f : RTF_RG8;
+		OutSourceFormat = bIs16Bit ? TSF_RGBA16F : TSF_BGRA8;
+		break;
+	default:
+		// TC_Alpha also lands here: it compresses the alpha channel, which a single-channel target would lose
+		OutRenderTargetFormat = bIs16Bit ? RTF_RGBA16f : RTF_RGBA8;
+		OutSourceFormat = bIs16Bit ? TSF_RGBA16F : TSF_BGRA8;
+		break;
+	}
+}
+
+bool FQuickBakerCore::ReadSourcePixels(UTextureRenderTarget2D* RenderTarget, ETextureSourceFormat SourceFormat, uint8* DstData, FQuickBakerCancellationToken& CancellationToken)
+{
+	FRenderTarget* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!RenderTargetResource)
+	{
+		return false;
+	}
+
+	const int64 NumPixels = (int64)RenderTarget->SizeX * RenderTarget->SizeY;
+	const ETextureRenderTargetFormat RenderTargetFormat = RenderTarget->RenderTargetFormat;
+
+	// Four-channel targets already match the source layout (FColor BGRA / FFloat16Color RGBA),
+	// so staging rows are copied straight into the destination without any per-pixel decode.
+	if (RenderTargetFormat == RTF_RGBA16f || RenderTargetFormat == RTF_RGBA8)
+	{
+		return FQuickBakerReadback::ReadColorPixels(RenderTarget, DstData, &CancellationToken);
+	}
+
+	// Same for single-channel targets whose native layout is the source format (R8 -> G8, R16f -> R16F, R32f -> R32F)
+	if (SourceFormat == TSF_G8 || SourceFormat == TSF_R16F || SourceFormat == TSF_R32F)
+	{
+		EPixelFormat PixelFormat;
+		return FQuickBakerReadback::ReadRawPixels(RenderTarget, DstData, PixelFormat, &CancellationToken);
+	}
+
+	// Single- and dual-channel targets are read in their native format, which the generic
+	// ReadPixels paths would otherwise expand to four channels per pixel.
+	TArray64<uint8> RawData;
+	EPixelFormat PixelFormat;
+	if (!FQuickBakerReadback::ReadRawPixels(RenderTarget, RawData, PixelFormat, &CancellationToken))
+	{
+		return false;
+	}
+
+	return ConvertSourcePixels(RawData.GetData(), PixelFormat, NumPixels, SourceFormat, DstData, CancellationToken);
+}
+
+bool FQuickBakerCore::ConvertSourcePixels(const uint8* RawData, EPixelFormat PixelFormat, int64 NumPixels, ETextureSourceFormat SourceFormat, uint8* DstData, FQuickBakerCancellationToken& CancellationToken)
+{
+	switch (SourceFormat)
+	{
+	case TSF_BGRA8:
+		if (PixelFormat == PF_R8G8)
+		{
+			const uint8* SrcData = RawData;
+			FColor* DstColors = reinterpret_cast<FColor*>(DstData);
+			return CancellationToken.ParallelForRange(NumPixels, [SrcData, DstColors](int64 Begin, int64 End)
+			{
+				for (int64 Index = Begin; Index < End; ++Index)
+				{
+					const uint8 X = SrcData[Index * 2];
+					const uint8 Y = SrcData[Index * 2 + 1];
+					const float NX = X / 127.5f - 1.0f;
+					const float NY = Y / 127.5f - 1.0f;
+					const float NZ = FMath::Sqrt(FMath::Max(0.0f, 1.0f - NX * NX - NY * NY));
+					DstColors[Index] = FColor(X, Y, (uint8)FMath::RoundToInt((NZ * 0.5f + 0.5f) * 255.0f), 255);
+				}
+			});
+		}
+		break;
+
+	case TSF_RGBA16F:
+		if (PixelFormat == PF_G16R16F)
+		{
+			const FFloat16* SrcData = reinterpret_cast<const FFloat16*>(RawData);
+			FFloat16Color* DstColors = reinterpret_cast<FFloat16Color*>(DstData);
+			return CancellationToken.ParallelForRange(NumPixels, [SrcData, DstColors](int64 Begin, int64 End)
+			{
+				for (int64 Index = Begin; Index < End; ++Index)
+				{
+					const float X = SrcData[Index * 2].GetFloat();
+					const float Y = SrcData[Index * 2 + 1].GetFloat();
+					const float NX = X * 2.0f - 1.0f;
+					const float NY = Y * 2.0f - 1.0f;
+					const float NZ = FMath::Sqrt(FMath::Max(0.0f, 1.0f - NX * NX - NY * NY));
+					DstColors[Index] = FFloat16Color(FLinearColor(X, Y, NZ * 0.5f + 0.5f, 1.0f));
+				}
+			});
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Unsupported conversion from %s to source format %d."), GPixelFormats[PixelFormat].Name, (int32)SourceFormat);
+	return false;
+}
+
+bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage)
+{
+	// Nested progress: 3 sub-phases (Setup, Read Pixels, Save to Disk)
+	FScopedSlowTask SubTask(3.0f, LOCTEXT("BakeToAsset", "Creating Texture Asset..."));
+
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: RenderTarget is null."));
+		OutResultMessage = LOCTEXT("Error_NullRT", "Render Target is null.");
+		return false;
+	}
+
+	// Sub-phase 1: Package & texture setup
+	SubTask.EnterProgressFrame(1.0f, LOCTEXT("AssetSetup", "Setting up package..."));
+
+	// Cubemaps become Texture Cube assets holding the six faces as slices
+	const bool bIsCubemap = Settings.BakeMode == EQuickBakerBakeMode::Cubemap;
+	UClass* TextureClass = bIsCubemap ? UTextureCube::StaticClass() : UTexture2D::StaticClass();
+
+	FString FullPackageName;
+	bool bIsNewTexture = false;
+	UTexture* NewTexture = FindOrCreateTextureAsset(Settings, TextureClass, FullPackageName, bIsNewTexture, OutResultMessage);
+	if (!NewTexture)
+	{
+		return false;
+	}
+
+	// Determine pixel format based on bit depth and the channels the compression setting keeps
+	ETextureRenderTargetFormat RenderTargetFormat;
+	ETextureSourceFormat SourceFormat;
+	GetAssetFormats(Settings, RenderTargetFormat, SourceFormat);
+	if (RenderTarget->RenderTargetFormat != RenderTargetFormat)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Render target format does not match the bake settings."));
+		OutResultMessage = LOCTEXT("Error_RTFormat", "Render target format does not match the bake settings.");
+		return false;
+	}
+
+	// A cubemap's render target holds its faces as grid cells; each face becomes one source slice.
+	const FIntPoint OutputSize(RenderTarget->SizeX, RenderTarget->SizeY);
+	const FIntPoint CellGrid = bIsCubemap ? Settings.GetCellGrid() : FIntPoint(1, 1);
+	const FIntPoint SourceSize(OutputSize.X / CellGrid.X, OutputSize.Y / CellGrid.Y);
+	const int32 NumSlices = bIsCubemap ? 6 : 1;
+	const int32 BytesPerPixel = FTextureSource::GetBytesPerPixel(SourceFormat);
+
+	// Read pixels from RenderTarget
+	FRenderTarget* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!RenderTargetResource)
 	{
-		FScopedSlowTask Task(4.0f, LOCTEXT("BakingTexture", "Baking Texture..."));
-		Task.MakeDialog(true);
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Could not get render target resource."));
+		OutResultMessage = LOCTEXT("Error_RTResource", "Failed to access render target resource.");
+		return false;
+	}
 
-		// Phase 1: Render Target Setup
-		Task.EnterProgressFrame(1.0f, LOCTEXT("SetupRT", "Setting up Render Target..."));
-		if (Task.ShouldCancel())
+	// Reads the whole source mip (every slice) into MipData
+	auto ReadMip = [&](uint8* MipData)
+	{
+		if (bIsCubemap)
 		{
-			return;
+			// Faces are read as one grid image, then split into the cube's slices
+			const int64 NumPixels = (int64)OutputSize.X * OutputSize.Y;
+			TArray64<uint8> GridData;
+			GridData.SetNumUninitialized(NumPixels * BytesPerPixel);
+			return ReadSourcePixels(RenderTarget, SourceFormat, GridData.GetData(), CancellationToken)
+				&& CopyCellsToSlices(GridData.GetData(), MipData, OutputSize, CellGrid, NumSlices, BytesPerPixel, CancellationToken);
 		}
+		return ReadSourcePixels(RenderTarget, SourceFormat, MipData, CancellationToken);
+	};
 
-		const bool bIsAsset = Settings.OutputType == EQuickBakerOutputType::Asset;
-		const bool bIsPNG = Settings.OutputType == EQuickBakerOutputType::PNG;
-		const bool bIsEXR = Settings.OutputType == EQuickBakerOutputType::EXR;
+	// Sub-phase 2: Read pixels from render target
+	SubTask.EnterProgressFrame(1.0f, LOCTEXT("ReadingPixels", "Reading pixels..."));
+
+	bool bReadSuccess = false;
+	bool bUnchanged = false;
+
+	// The analysis pass needs the whole image before choosing a format, so it always goes through the scratch path.
+	// Cubemaps keep their format; their faces would each need the same choice.
+	const bool bAutoSelectFormat = Settings.bAutoSelectFormat && !bIsCubemap;
+	FQuickBakerFormatChoice Choice;
+	Choice.Format = SourceFormat;
+	Choice.Compression = Settings.Compression;
+	Choice.Size = SourceSize;
+
+	// PNG source storage is lossless but only exists for 2D integer formats; cubemaps and float sources stay raw
+	auto SupportsCompressedSource = [&Settings, bIsCubemap](ETextureSourceFormat Format)
+	{
+		return Settings.bCompressSource && !bIsCubemap && (Format == TSF_BGRA8 || Format == TSF_G8 || Format == TSF_G16);
+	};
+
+	// Pixels of the scratch path, stored into the source only after the last cancel point
+	TArray64<uint8> NewPixels;
+	TArray64<uint8> CompressedPixels;
+	bool bCompressSource = false;
+	bool bReplaceSource = false;
 
-		// Determine Format
-		ETextureRenderTargetFormat Format = RTF_RGBA16f;
-		if (bIsAsset)
+	if (bIsNewTexture && !bAutoSelectFormat && !SupportsCompressedSource(SourceFormat))
+	{
+		// Read straight into the locked mip; there is nothing to compare against or preserve
+		NewTexture->Source.Init(SourceSize.X, SourceSize.Y, NumSlices, 1, SourceFormat);
+		uint8* MipData = NewTexture->Source.LockMip(0);
+		bReadSuccess = ReadMip(MipData);
+		NewTexture->Source.UnlockMip(0);
+	}
+	else
+	{
+		// Existing textures are read into a scratch buffer first, so their source is only replaced
+		// once the new pixels are complete and actually differ from what is already stored.
+		const int64 NumPixels = (int64)SourceSize.X * SourceSize.Y * NumSlices;
+		NewPixels.SetNumUninitialized(NumPixels * BytesPerPixel);
+		bReadSuccess = ReadMip(NewPixels.GetData());
+
+		if (bReadSuccess && bAutoSelectFormat)
 		{
-			bool bIs16Bit = Settings.BitDepth == EQuickBakerBitDepth::Bit16;
-			Format = bIs16Bit ? RTF_RGBA16f : RTF_RGBA8;
+			FQuickBakerImageStats Stats;
+			bReadSuccess = FQuickBakerAnalysis::Analyze(NewPixels.GetData(), NumPixels, SourceFormat, Stats, CancellationToken);
+			if (bReadSuccess)
+			{
+				Choice = FQuickBakerAnalysis::ChooseFormat(Stats, SourceFormat, Settings.Compression, SourceSize, Settings.bAllowRangeRemap, Settings.AutoFormatMaxError);
+				UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: Analysis of %s: %d channel(s), grayscale %d, constant alpha %d, constant %d, %d/%d/%d/%d histogram levels used. Storing as format %d (%dx%d)."),
+					*FullPackageName, Stats.NumChannels, Stats.bGrayscale, Stats.bConstantAlpha, Stats.bConstantColor,
+					Stats.GetUsedLevels(0), Stats.GetUsedLevels(1), Stats.GetUsedLevels(2), Stats.GetUsedLevels(3),
+					(int32)Choice.Format, Choice.Size.X, Choice.Size.Y);
+			}
+
+			if (bReadSuccess && (Choice.Format != SourceFormat || Choice.Size != SourceSize || Choice.IsRemapped()))
+			{
+				TArray64<uint8> ConvertedPixels;
+				bReadSuccess = FQuickBakerAnalysis::ConvertPixels(NewPixels.GetData(), NumPixels, SourceFormat, Choice, ConvertedPixels, CancellationToken);
+				NewPixels = MoveTemp(ConvertedPixels);
+			}
 		}
-		else if (bIsPNG)
+
+		bCompressSource = SupportsCompressedSource(Choice.Format);
+		const ETextureSourceCompressionFormat SourceCompression = bCompressSource ? TSCF_PNG : TSCF_None;
+		const int64 MipBytes = (int64)Choice.Size.X * Choice.Size.Y * NumSlices * FTextureSource::GetBytesPerPixel(Choice.Format);
+
+		FQuickBakerOutputRule OutputRule;
+		const bool bHasOutputRule = FQuickBakerOutputProfile::FindRule(Settings, Choice.Size, OutputRule);
+
+		FTextureSource& Source = NewTexture->Source;
+		const bool bSameLayout = !bIsNewTexture
+			&& Source.GetSizeX() == Choice.Size.X && Source.GetSizeY() == Choice.Size.Y
+			&& Source.GetNumSlices() == NumSlices && Source.GetNumMips() == 1 && Source.GetNumBlocks() == 1
+			&& Source.GetNumLayers() == 1 && Source.GetFormat() == Choice.Format
+			&& Source.GetSourceCompression() == SourceCompression
+			&& NewTexture->CompressionSettings == Choice.Compression && !NewTexture->SRGB
+			&& FQuickBakerOutputProfile::IsApplied(bHasOutputRule ? &OutputRule : nullptr, NewTexture);
+
+		// A remapped image is only unchanged if the mapping back to the baked values is unchanged as well
+		const bool bSameRemap = !bAutoSelectFormat || MatchesRangeRemapMetaData(NewTexture, Choice);
+
+		if (bReadSuccess && Settings.bSkipUnchangedAssets && bSameLayout && bSameRemap)
 		{
-			Format = RTF_RGBA8;
+			const uint8* OldPixels = Source.LockMipReadOnly(0, 0, 0);
+			bUnchanged = OldPixels && MatchesSourcePixels(OldPixels, NewPixels.GetData(), MipBytes, Choice.Format, Settings.UnchangedTolerance);
+			Source.UnlockMip(0, 0, 0);
 		}
-		else if (bIsEXR)
+
+		if (bReadSuccess && !bUnchanged && bCompressSource && !CancellationToken.ShouldCancel())
 		{
-			Format = RTF_RGBA16f;
+			bReadSuccess = CompressSourcePNG(NewPixels.GetData(), Choice.Size, Choice.Format, CompressedPixels, CancellationToken);
 		}
+		bReplaceSource = bReadSuccess && !bUnchanged;
+	}
 
-		// Setup Render Target
-		// Create a transient render target.
-		UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(
-			GetTransientPackage(),
-			NAME_None,
-			RF_Transient
-		);
-
-		// GC Protection: Add to root to prevent garbage collection during the baking process.
-		if (RenderTarget)
+	// Replacing the source and saving cannot be interrupted, so this is the last point a cancel is honoured; an
+	// existing texture is still untouched here, and nothing can leave it with new pixels but its old settings
+	if (CancellationToken.ShouldCancel())
+	{
+		if (bIsNewTexture)
 		{
-			RenderTarget->AddToRoot();
+			// Drop the half-written texture so the transient package does not show up in the Content Browser
+			NewTexture->ClearFlags(RF_Public | RF_Standalone);
+			NewTexture->MarkAsGarbage();
 		}
+		UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset canceled: %s was not saved."), *FullPackageName);
+		return false;
+	}
 
-		// Ensure RemoveFromRoot is called when the function exits (even if early return occurs).
-		ON_SCOPE_EXIT
+	if (!bReadSuccess)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: No pixel data read from render target."));
+		OutResultMessage = LOCTEXT("Error_NoPixels", "Failed to read pixels from render target.");
+		return false;
+	}
+
+	// Identical pixels would only invalidate the DDC entry, recompress and produce a no-op source-control diff
+	if (bUnchanged)
+	{
+		++NumUnchangedSaveSkips;
+		UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: %s is unchanged, skipped saving."), *FullPackageName);
+		OutResultMessage = FText::Format(LOCTEXT("Success_Unchanged", "Texture is unchanged, save skipped.\nAsset: {0}"),
+			FText::FromString(FullPackageName));
+		return true;
+	}
+
+	if (bReplaceSource)
+	{
+		FQuickBakerTextureUpdateQueue::PrepareSourceChange(NewTexture);
+		if (bCompressSource)
 		{
-			if (RenderTarget)
-			{
-				RenderTarget->RemoveFromRoot();
-			}
-		};
+			NewTexture->Source.InitWithCompressedSourceData(Choice.Size.X, Choice.Size.Y, 1, Choice.Format, CompressedPixels, TSCF_PNG);
+		}
+		else
+		{
+			NewTexture->Source.Init(Choice.Size.X, Choice.Size.Y, NumSlices, 1, Choice.Format, NewPixels.GetData());
+		}
+		NewPixels.Empty();
+		CompressedPixels.Empty();
+	}
 
-		if (!RenderTarget)
+	// Initialize texture properties
+	NewTexture->CompressionSettings = Choice.Compression;
+	if (bAutoSelectFormat)
+	{
+		// Single-channel storage of a four-channel bake only happens when its alpha was constant
+		const bool bDroppedAlpha = (SourceFormat == TSF_BGRA8 || SourceFormat == TSF_RGBA16F)
+			&& Choice.Format != TSF_BGRA8 && Choice.Format != TSF_RGBA16F;
+		SetRangeRemapMetaData(NewTexture, Choice, bDroppedAlpha);
+	}
+	NewTexture->SRGB = false;
+
+	// Texture group, mips, size limit and streaming come from the project's output rules, reported before the save
+	const FString MemoryReport = ApplyOutputRule(Settings, NewTexture, Choice.Size, NumSlices, FullPackageName);
+
+	// Sub-phase 3: Save to disk
+	SubTask.EnterProgressFrame(1.0f, LOCTEXT("SavingAsset", "Saving asset to disk..."));
+
+	const bool bSaved = SaveTextureAsset(NewTexture, FullPackageName, bIsNewTexture, OutResultMessage);
+	if (bSaved && !MemoryReport.IsEmpty())
+	{
+		OutResultMessage = FText::Format(LOCTEXT("Success_MemoryReport", "{0}\n\n{1}"), OutResultMessage, FText::FromString(MemoryReport));
+	}
+	return bSaved;
+}
+
+bool FQuickBakerCore::BakeUDIMTiles(UWorld* World, UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage)
+{
+	UMaterialInterface* Material = Settings.SelectedMaterial.Get();
+	if (!World || !RenderTarget || !Material)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeUDIMTiles failed: Missing world, render target or material."));
+		OutResultMessage = LOCTEXT("Error_UDIMSetup", "Failed to set up the UDIM bake.");
+		return false;
+	}
+
+	const int32 NumTiles = Settings.GetUDIMTileCount();
+	const FIntPoint TileSize(RenderTarget->SizeX, RenderTarget->SizeY);
+	const int64 NumTilePixels = (int64)TileSize.X * TileSize.Y;
+
+	// Nested progress: one frame per tile
+	FScopedSlowTask SubTask((float)NumTiles, LOCTEXT("BakingUDIM", "Baking UDIM tiles..."));
+
+	// Draws the material over one tile's UV range, then the post-process chain and the given copy passes, if any.
+	// The draw is only queued; the tile's readback flushes it.
+	auto DrawTile = [&](int32 TileIndex, FQuickBakerGraphPasses CopyPasses)
+	{
+		SubTask.EnterProgressFrame(1.0f, FText::Format(LOCTEXT("BakingUDIMTile", "Baking tile {0}..."),
+			FText::AsNumber(Settings.GetUDIMTileNumber(TileIndex), &FNumberFormattingOptions::DefaultNoGrouping())));
+		if (CancellationToken.ShouldCancel())
 		{
-			UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Failed to create render target."));
-			ResultMessage = LOCTEXT("Error_RTCreate", "Failed to create render target.");
-			FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
-			return;
+			return false;
 		}
 
-		// Validate resolution does not exceed GPU hardware limit
+		FQuickBakerGraphPasses AfterDraw = MakePostProcessPasses(Settings);
+		if (CopyPasses)
 		{
-			// GMaxTextureDimensions is a TRHIGlobal<int32> from RHI.h (linked via RHI module)
-			const int32 RHIMax = static_cast<int32>(GMaxTextureDimensions);
-			const int32 MaxDimension = (RHIMax > 0) ? RHIMax : 16384; // Fallback if RHI not yet initialized
-			if (Settings.Resolution > MaxDimension)
+			AfterDraw = [PostProcessPasses = MoveTemp(AfterDraw), CopyPasses = MoveTemp(CopyPasses)](FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)
 			{
-				UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Resolution %d exceeds maximum supported texture dimension %d."), Settings.Resolution, MaxDimension);
-				FMessageDialog::Open(EAppMsgType::Ok, FText::Format(
-					LOCTEXT("Error_ResolutionExceedsMax", "Resolution {0} exceeds the maximum supported texture dimension ({1})."),
-					FText::AsNumber(Settings.Resolution),
-					FText::AsNumber(MaxDimension)));
-				return;
-			}
+				if (PostProcessPasses)
+				{
+					PostProcessPasses(GraphBuilder, BakeTarget);
+				}
+				CopyPasses(GraphBuilder, BakeTarget);
+			};
 		}
 
-		RenderTarget->InitAutoFormat(Settings.Resolution, Settings.Resolution);
-		RenderTarget->RenderTargetFormat = Format;
-		RenderTarget->bForceLinearGamma = true;
-		RenderTarget->SRGB = false;
-		RenderTarget->UpdateResourceImmediate(true);
+		FQuickBakerMaterialDraw Draw;
+		Draw.Material = Material;
+		Draw.UV0 = FVector2D(TileIndex % Settings.UDIMTilesU, TileIndex / Settings.UDIMTilesU);
+		Draw.UV1 = Draw.UV0 + FVector2D::UnitVector;
+		return FQuickBakerRenderer::DrawMaterials(World, RenderTarget, MakeArrayView(&Draw, 1), MoveTemp(AfterDraw));
+	};
 
-		// Phase 2: Material Rendering
-		Task.EnterProgressFrame(2.0f, LOCTEXT("Rendering", "Rendering Material..."));
-		if (Task.ShouldCancel())
+	if (Settings.OutputType == EQuickBakerOutputType::Asset)
+	{
+		FString FullPackageName;
+		bool bIsNewTexture = false;
+		UTexture* Texture = FindOrCreateTextureAsset(Settings, UTexture2D::StaticClass(), FullPackageName, bIsNewTexture, OutResultMessage);
+		if (!Texture)
 		{
-			return;
+			return false;
 		}
 
-		UWorld* World = nullptr;
-		if (GEditor)
+		ETextureRenderTargetFormat RenderTargetFormat;
+		ETextureSourceFormat SourceFormat;
+		GetAssetFormats(Settings, RenderTargetFormat, SourceFormat);
+		if (RenderTarget->RenderTargetFormat != RenderTargetFormat)
 		{
-			World = GEditor->GetEditorWorldContext().World();
+			UE_LOG(LogQuickBaker, Error, TEXT("BakeUDIMTiles failed: Render target format does not match the bake settings."));
+			OutResultMessage = LOCTEXT("Error_RTFormat", "Render target format does not match the bake settings.");
+			return false;
 		}
 
-		if (!World)
+		// Tiles are written straight into one buffer laid out as the source blocks, which the texture takes over without a
+		// copy once every tile is complete, so a failed or canceled bake leaves an existing texture as it was
+		const int64 TileBytes = NumTilePixels * FTextureSource::GetBytesPerPixel(SourceFormat);
+		FUniqueBuffer SourceData = FUniqueBuffer::Alloc(TileBytes * NumTiles);
+		uint8* SourceBytes = static_cast<uint8*>(SourceData.GetData());
+
+		// Targets whose native layout is the source format are copied into their block; two-channel normal maps are
+		// read into one of two staging tiles and expanded from there
+		const bool bIsColorTarget = RenderTargetFormat == RTF_RGBA8 || RenderTargetFormat == RTF_RGBA16f;
+		const bool bReadInPlace = bIsColorTarget || SourceFormat == TSF_G8 || SourceFormat == TSF_R16F || SourceFormat == TSF_R32F;
+		const int32 TargetBytesPerPixel = GPixelFormats[RenderTarget->GetFormat()].BlockBytes;
+		TArray64<uint8> StagingTiles[2];
+		if (!bReadInPlace)
 		{
-			UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: No valid editor world found."));
-			ResultMessage = LOCTEXT("Error_NoWorld", "No valid editor world found.");
-			FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
-			return;
+			StagingTiles[0].SetNumUninitialized(NumTilePixels * TargetBytesPerPixel);
+			StagingTiles[1].SetNumUninitialized(NumTilePixels * TargetBytesPerPixel);
 		}
 
-		UKismetRenderingLibrary::ClearRenderTarget2D(World, RenderTarget, FLinearColor::Black);
-		UKismetRenderingLibrary::DrawMaterialToRenderTarget(World, RenderTarget, Settings.SelectedMaterial.Get());
+		// Declared after the buffers they write to, so their destructors flush any copy still queued before those go
+		FQuickBakerAsyncReadback Readbacks[2];
 
-		// Ensure all rendering commands are completed before reading pixels.
-		// Note: Caller is responsible for flushing before passing RT to BakeToAsset / ExportToFile
-		FlushRenderingCommands();
+		// Queues the draw of a tile followed by the copy of its pixels, without waiting for either
+		auto QueueTile = [&](int32 TileIndex)
+		{
+			FQuickBakerAsyncReadback& Readback = Readbacks[TileIndex % 2];
+			uint8* Destination = bReadInPlace ? SourceBytes + TileIndex * TileBytes : StagingTiles[TileIndex % 2].GetData();
+			if (!DrawTile(TileIndex, Readback.Begin(TileSize, TargetBytesPerPixel, Destination)))
+			{
+				Readback.Reset();
+				return false;
+			}
+			return true;
+		};
 
-		// Phase 3: Save
-		Task.EnterProgressFrame(1.0f, LOCTEXT("Saving", "Saving..."));
-		if (Task.ShouldCancel())
+		// Waits for a tile's pixels and turns them into its source block
+		auto CollectTile = [&](int32 TileIndex)
 		{
-			return;
-		}
+			FQuickBakerAsyncReadback& Readback = Readbacks[TileIndex % 2];
+			while (!Readback.Poll())
+			{
+				if (Readback.HasFailed() || CancellationToken.ShouldCancel())
+				{
+					return false;
+				}
+				FPlatformProcess::SleepNoStats(0.001f);
+			}
+
+			uint8* TileData = SourceBytes + TileIndex * TileBytes;
+			if (!bReadInPlace)
+			{
+				return ConvertSourcePixels(StagingTiles[TileIndex % 2].GetData(), Readback.GetPixelFormat(), NumTilePixels, SourceFormat, TileData, CancellationToken);
+			}
+			return !bIsColorTarget || FQuickBakerReadback::ConvertToColorPixels(TileData, NumTilePixels, Readback.GetPixelFormat());
+		};
 
-		if (bIsAsset)
+		// The single render target is drawn in graph order, so tile N + 1 can be queued behind tile N's copy and render
+		// on the GPU while tile N is collected on the CPU
+		bool bReadSuccess = QueueTile(0);
+		for (int32 TileIndex = 0; TileIndex < NumTiles && bReadSuccess; ++TileIndex)
 		{
-			bSuccess = BakeToAsset(RenderTarget, Settings, ResultMessage);
+			if (TileIndex + 1 < NumTiles)
+			{
+				bReadSuccess = QueueTile(TileIndex + 1);
+			}
+			bReadSuccess = bReadSuccess && CollectTile(TileIndex);
 		}
-		else
-		{
-			// External Export
-			FString Extension = bIsPNG ? TEXT(".png") : TEXT(".exr");
-			FString FullPath = FPaths::Combine(Settings.OutputPath, Settings.OutputName + Extension);
 
-			bSuccess = FQuickBakerExporter::ExportToFile(RenderTarget, FullPath, bIsPNG);
-			if (bSuccess)
+		if (!bReadSuccess || CancellationToken.ShouldCancel())
+		{
+			if (bIsNewTexture)
 			{
-				UE_LOG(LogQuickBaker, Log, TEXT("ExecuteBake success: Saved to %s"), *FullPath);
-				ResultMessage = FText::Format(LOCTEXT("Success_Export", "Saved to {0}"), FText::FromString(FullPath));
+				// Drop the unused texture so the transient package does not show up in the Content Browser
+				Texture->ClearFlags(RF_Public | RF_Standalone);
+				Texture->MarkAsGarbage();
 			}
-			else
+
+			if (!CancellationToken.IsCanceled())
 			{
-				UE_LOG(LogQuickBaker, Error, TEXT("ExecuteBake failed: Failed to save file to disk or convert image at %s"), *FullPath);
-				ResultMessage = LOCTEXT("Error_SaveFile", "Failed to save file to disk or convert image.");
+				UE_LOG(LogQuickBaker, Error, TEXT("BakeUDIMTiles failed: Could not render or read a tile of %s."), *FullPackageName);
+				OutResultMessage = LOCTEXT("Error_UDIMTile", "Failed to render or read a UDIM tile.");
 			}
+			return false;
 		}
-	} // FScopedSlowTask is destroyed here — progress bar reaches 100% and closes
 
-	// Show result dialog after the progress bar has fully completed
-	FMessageDialog::Open(EAppMsgType::Ok, ResultMessage);
-}
+		// One source block per tile at its UDIM coordinates, in the order the tiles were written to the buffer
+		TArray<FTextureSourceBlock> Blocks;
+		Blocks.SetNum(NumTiles);
+		for (int32 TileIndex = 0; TileIndex < NumTiles; ++TileIndex)
+		{
+			Blocks[TileIndex].BlockX = TileIndex % Settings.UDIMTilesU;
+			Blocks[TileIndex].BlockY = TileIndex / Settings.UDIMTilesU;
+			Blocks[TileIndex].SizeX = TileSize.X;
+			Blocks[TileIndex].SizeY = TileSize.Y;
+			Blocks[TileIndex].NumSlices = 1;
+			Blocks[TileIndex].NumMips = 1;
+		}
+		FQuickBakerTextureUpdateQueue::PrepareSourceChange(Texture);
+		Texture->Source.InitBlocked(&SourceFormat, Blocks.GetData(), 1, NumTiles, UE::Serialization::FEditorBulkData::FSharedBufferWithID(SourceData.MoveToShared()));
 
-bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FText& OutResultMessage)
-{
-	// Nested progress: 3 sub-phases (Setup, Read Pixels, Save to Disk)
-	FScopedSlowTask SubTask(3.0f, LOCTEXT("BakeToAsset", "Creating Texture Asset..."));
+		Texture->CompressionSettings = Settings.Compression;
+		Texture->SRGB = false;
+		const FString MemoryReport = ApplyOutputRule(Settings, Texture, TileSize, NumTiles, FullPackageName);
 
-	if (!RenderTarget)
+		const bool bSaved = SaveTextureAsset(Texture, FullPackageName, bIsNewTexture, OutResultMessage);
+		if (bSaved && !MemoryReport.IsEmpty())
+		{
+			OutResultMessage = FText::Format(LOCTEXT("Success_MemoryReport", "{0}\n\n{1}"), OutResultMessage, FText::FromString(MemoryReport));
+		}
+		return bSaved;
+	}
+
+	const bool bIsFloat = Settings.UsesFloatPixels();
+	const int64 BytesPerPixel = bIsFloat ? sizeof(FFloat16Color) : sizeof(FColor);
+	const TCHAR* Extension = FQuickBakerSettings::GetFileExtension(Settings.OutputType);
+	const EQuickBakerOutputType OutputType = Settings.OutputType;
+
+	// Worker threads must not load modules, so the encoder module is loaded before the first tile is handed off
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	// Tile N is encoded and written on a worker while tile N + 1 renders and reads back
+	TFuture<bool> PendingWrite;
+	auto WaitForPendingWrite = [&PendingWrite, &CancellationToken]()
 	{
-		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: RenderTarget is null."));
-		OutResultMessage = LOCTEXT("Error_NullRT", "Render Target is null.");
-		return false;
+		if (!PendingWrite.IsValid())
+		{
+			return true;
+		}
+
+		// Keep the progress dialog responsive; the worker sees a cancel through the shared token
+		while (!PendingWrite.WaitFor(FTimespan::FromMilliseconds(20.0)))
+		{
+			CancellationToken.ShouldCancel();
+		}
+		return PendingWrite.Consume();
+	};
+
+	bool bSuccess = true;
+	for (int32 TileIndex = 0; TileIndex < NumTiles && bSuccess; ++TileIndex)
+	{
+		TArray64<uint8> TilePixels;
+		bSuccess = DrawTile(TileIndex, nullptr);
+		if (bSuccess)
+		{
+			TilePixels.SetNumUninitialized(NumTilePixels * BytesPerPixel);
+			bSuccess = FQuickBakerReadback::ReadColorPixels(RenderTarget, TilePixels.GetData(), &CancellationToken);
+		}
+
+		// The previous tile's buffer is released here, so no more than two tiles are ever held
+		bSuccess = WaitForPendingWrite() && bSuccess;
+		if (!bSuccess)
+		{
+			break;
+		}
+
+		const FString FullPath = FPaths::Combine(Settings.OutputPath,
+			FString::Printf(TEXT("%s.%d.%s"), *Settings.OutputName, Settings.GetUDIMTileNumber(TileIndex), Extension));
+		PendingWrite = Async(EAsyncExecution::ThreadPool, [Pixels = MoveTemp(TilePixels), FullPath, TileSize, bIsFloat, OutputType, &CancellationToken]()
+		{
+			return FQuickBakerExporter::ExportPixelsToFile(Pixels.GetData(), TileSize.X, TileSize.Y, bIsFloat, FullPath, OutputType, &CancellationToken);
+		});
 	}
+	bSuccess = WaitForPendingWrite() && bSuccess;
 
-	// Sub-phase 1: Package & texture setup
-	SubTask.EnterProgressFrame(1.0f, LOCTEXT("AssetSetup", "Setting up package..."));
+	const FString TilePattern = FPaths::Combine(Settings.OutputPath, FString::Printf(TEXT("%s.<UDIM>.%s"), *Settings.OutputName, Extension));
+	if (bSuccess)
+	{
+		UE_LOG(LogQuickBaker, Log, TEXT("BakeUDIMTiles success: Saved %d tiles to %s"), NumTiles, *TilePattern);
+		OutResultMessage = FText::Format(LOCTEXT("Success_UDIM", "Saved {0} UDIM tiles to {1}"), FText::AsNumber(NumTiles), FText::FromString(TilePattern));
+	}
+	else if (!CancellationToken.IsCanceled())
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeUDIMTiles failed: Could not render or save every tile of %s"), *TilePattern);
+		OutResultMessage = LOCTEXT("Error_UDIMFiles", "Failed to render or save every UDIM tile. Tiles saved before the failure were kept.");
+	}
+	return bSuccess;
+}
 
+FString FQuickBakerCore::GetAssetPackageName(const FQuickBakerSettings& Settings)
+{
 	// Normalize package path
 	FString PackagePath = Settings.OutputPath;
 	if (!PackagePath.StartsWith(TEXT("/Game/")))
@@ -203,13 +1301,18 @@ bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQ
 	}
 
 	// Build full package name
-	FString FullPackageName = FPaths::Combine(PackagePath, Settings.OutputName);
+	return FPaths::Combine(PackagePath, Settings.OutputName);
+}
+
+UTexture* FQuickBakerCore::FindOrCreateTextureAsset(const FQuickBakerSettings& Settings, UClass* TextureClass, FString& OutFullPackageName, bool& bOutIsNewTexture, FText& OutResultMessage)
+{
+	OutFullPackageName = GetAssetPackageName(Settings);
 
-	UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: Creating texture at package: %s"), *FullPackageName);
+	UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: Creating texture at package: %s"), *OutFullPackageName);
 
 	// Ensure physical directory exists
 	FString PackageFilename;
-	if (FPackageName::TryConvertLongPackageNameToFilename(FullPackageName, PackageFilename, FPackageName::GetAssetPackageExtension()))
+	if (FPackageName::TryConvertLongPackageNameToFilename(OutFullPackageName, PackageFilename, FPackageName::GetAssetPackageExtension()))
 	{
 		FString PackageDirectory = FPaths::GetPath(PackageFilename);
 		if (!IFileManager::Get().DirectoryExists(*PackageDirectory))
@@ -218,32 +1321,64 @@ bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQ
 			{
 				UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Failed to create output directory at %s"), *PackageDirectory);
 				OutResultMessage = LOCTEXT("Error_MakeDirectory", "Failed to create output directory.");
-				return false;
+				return nullptr;
 			}
 		}
 	}
 
-	// Create package
-	UPackage* Package = CreatePackage(*FullPackageName);
-	if (!Package)
+	// Rebakes find the existing asset through the asset registry and load only that texture.
+	// Its source bulk data stays on disk until it is compared or replaced, instead of Package->FullyLoad() pulling in everything.
+	UPackage* Package = nullptr;
+	UTexture* NewTexture = nullptr;
 	{
-		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Failed to create package: %s"), *FullPackageName);
-		OutResultMessage = LOCTEXT("Error_CreatePackage", "Failed to create package.");
-		return false;
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		const FAssetData ExistingAsset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(OutFullPackageName + TEXT(".") + Settings.OutputName));
+		if (ExistingAsset.IsValid())
+		{
+			NewTexture = Cast<UTexture>(ExistingAsset.GetAsset());
+			if (!NewTexture)
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Existing asset %s is a %s, expected a texture."), *OutFullPackageName, *ExistingAsset.AssetClassPath.ToString());
+				OutResultMessage = LOCTEXT("Error_TextureClassMismatch", "An asset of a different texture type already exists at the output path.");
+				return nullptr;
+			}
+			Package = NewTexture->GetPackage();
+		}
 	}
 
-	Package->FullyLoad();
+	if (!Package)
+	{
+		// Create package
+		Package = CreatePackage(*OutFullPackageName);
+		if (!Package)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Failed to create package: %s"), *OutFullPackageName);
+			OutResultMessage = LOCTEXT("Error_CreatePackage", "Failed to create package.");
+			return nullptr;
+		}
+
+		// Covers packages on disk the asset registry has not scanned yet
+		Package->FullyLoad();
+		NewTexture = FindObject<UTexture>(Package, *Settings.OutputName);
+	}
 
 	// Check if asset already exists
-	UTexture2D* NewTexture = FindObject<UTexture2D>(Package, *Settings.OutputName);
+	bOutIsNewTexture = NewTexture == nullptr;
 	if (NewTexture)
 	{
-		UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: Updating existing asset %s"), *FullPackageName);
+		if (!NewTexture->IsA(TextureClass))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Existing asset %s is a %s, expected %s."), *OutFullPackageName, *NewTexture->GetClass()->GetName(), *TextureClass->GetName());
+			OutResultMessage = LOCTEXT("Error_TextureClassMismatch", "An asset of a different texture type already exists at the output path.");
+			return nullptr;
+		}
+		UE_LOG(LogQuickBaker, Log, TEXT("BakeToAsset: Updating existing asset %s"), *OutFullPackageName);
 	}
 	else
 	{
-		NewTexture = NewObject<UTexture2D>(
+		NewTexture = NewObject<UTexture>(
 			Package,
+			TextureClass,
 			*Settings.OutputName,
 			RF_Public | RF_Standalone
 		);
@@ -251,113 +1386,26 @@ bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQ
 
 	if (!NewTexture)
 	{
-		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Failed to create UTexture2D object."));
+		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Failed to create %s object."), *TextureClass->GetName());
 		OutResultMessage = LOCTEXT("Error_CreateTexture", "Failed to create texture object.");
-		return false;
-	}
-
-	// Determine pixel format based on bit depth
-	bool bIs16Bit = (Settings.BitDepth == EQuickBakerBitDepth::Bit16);
-	ETextureSourceFormat SourceFormat = bIs16Bit ? TSF_RGBA16F : TSF_BGRA8;
-
-	// Initialize texture properties
-	NewTexture->Source.Init(Settings.Resolution, Settings.Resolution, 1, 1, SourceFormat);
-	NewTexture->CompressionSettings = Settings.Compression;
-	NewTexture->SRGB = false;
-	NewTexture->MipGenSettings = TMGS_NoMipmaps;
-
-	// Read pixels from RenderTarget
-	FRenderTarget* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
-	if (!RenderTargetResource)
-	{
-		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Could not get render target resource."));
-		OutResultMessage = LOCTEXT("Error_RTResource", "Failed to access render target resource.");
-		return false;
-	}
-
-	// Sub-phase 2: Read pixels from render target
-	SubTask.EnterProgressFrame(1.0f, LOCTEXT("ReadingPixels", "Reading pixels..."));
-
-	// Lock the texture mip for editing
-	uint8* MipData = NewTexture->Source.LockMip(0);
-	int64 TextureDataSize = 0;
-	bool bReadSuccess = false;
-
-	const int64 NumPixels = (int64)Settings.Resolution * Settings.Resolution;
-
-	if (bIs16Bit)
-	{
-		TArray<FFloat16Color> SurfaceData;
-		if (RenderTargetResource->ReadFloat16Pixels(SurfaceData))
-		{
-			if (SurfaceData.Num() > 0)
-			{
-				if (SurfaceData.Num() != NumPixels)
-				{
-					UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Pixel count mismatch. Expected %lld, got %d"), NumPixels, SurfaceData.Num());
-				}
-				else
-				{
-					// FMemory::Memcpy is retained for 16-bit path: contiguous bulk copy is faster than
-					// ParallelFor for FFloat16Color since no per-pixel transformation is needed.
-					TextureDataSize = (int64)SurfaceData.Num() * sizeof(FFloat16Color);
-					FMemory::Memcpy(MipData, SurfaceData.GetData(), TextureDataSize);
-					bReadSuccess = true;
-				}
-			}
-		}
-	}
-	else
-	{
-		TArray<FColor> SurfaceData;
-		FReadSurfaceDataFlags ReadPixelFlags(RCM_MinMax);
-		ReadPixelFlags.SetLinearToGamma(false);
-
-		if (RenderTargetResource->ReadPixels(SurfaceData, ReadPixelFlags))
-		{
-			if (SurfaceData.Num() > 0)
-			{
-				if (SurfaceData.Num() != NumPixels)
-				{
-					UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: Pixel count mismatch. Expected %lld, got %d"), NumPixels, SurfaceData.Num());
-				}
-				else
-				{
-					// ParallelFor pixel copy to allow future per-pixel operations (swizzle, etc.)
-					const FColor* SrcData = SurfaceData.GetData();
-					FColor* DstData = reinterpret_cast<FColor*>(MipData);
-					ParallelFor(NumPixels, [SrcData, DstData](int64 Index)
-					{
-						DstData[Index] = SrcData[Index];
-					});
-					TextureDataSize = NumPixels * sizeof(FColor);
-					bReadSuccess = true;
-				}
-			}
-		}
-	}
-
-	// Unlock the mip
-	NewTexture->Source.UnlockMip(0);
-
-	if (!bReadSuccess)
-	{
-		UE_LOG(LogQuickBaker, Error, TEXT("BakeToAsset failed: No pixel data read from render target."));
-		OutResultMessage = LOCTEXT("Error_NoPixels", "Failed to read pixels from render target.");
-		return false;
+		return nullptr;
 	}
 
-	// Sub-phase 3: Save to disk
-	SubTask.EnterProgressFrame(1.0f, LOCTEXT("SavingAsset", "Saving asset to disk..."));
+	return NewTexture;
+}
 
-	// Update texture
-	NewTexture->UpdateResource();
+bool FQuickBakerCore::SaveTextureAsset(UTexture* Texture, const FString& FullPackageName, bool bIsNewTexture, FText& OutResultMessage)
+{
+	UPackage* Package = Texture->GetPackage();
 
 	// Mark package as dirty
 	Package->MarkPackageDirty();
 
 	// Notify asset registry
-	FAssetRegistryModule::AssetCreated(NewTexture);
+	if (bIsNewTexture)
+	{
+		FAssetRegistryModule::AssetCreated(Texture);
+	}
 
 	// Save package to disk
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(FullPackageName, FPackageName::GetAssetPackageExtension());
@@ -367,7 +1415,12 @@ bool FQuickBakerCore::BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQ
 	SaveArgs.SaveFlags = SAVE_NoError;
 	SaveArgs.Error = GError;
 
-	bool bSaved = UPackage::SavePackage(Package, NewTexture, *PackageFileName, SaveArgs);
+	bool bSaved = UPackage::SavePackage(Package, Texture, *PackageFileName, SaveArgs);
+
+	// Update texture
+	// Saving only needs the source, so platform compression starts afterwards on the asynchronous texture compiler
+	// and the bake returns without waiting for it. Rebaked textures that are not on screen are updated after the bake.
+	FQuickBakerTextureUpdateQueue::RequestUpdate(Texture, !bIsNewTexture);
 
 	if (bSaved)
 	{
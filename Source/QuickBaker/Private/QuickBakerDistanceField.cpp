@@ -0,0 +1,156 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerDistanceField.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+
+namespace QuickBakerDistanceField
+{
+	/** Squared distance standing in for "no seed"; large, but finite so the parabola intersections stay defined. */
+	static constexpr float NoSeed = 1e20f;
+
+	/**
+	 * One-dimensional squared distance transform of Felzenszwalb and Huttenlocher: the lower envelope of parabolas
+	 * rooted at every sample. Reads and writes Count samples Stride apart.
+	 * Scratch buffers hold Count parabola vertices and Count + 1 envelope boundaries.
+	 */
+	static void TransformLine(float* Data, int32 Count, int64 Stride, float* Values, int32* Vertices, double* Boundaries)
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Values[Index] = Data[Index * Stride];
+		}
+
+		int32 NumParabolas = 0;
+		Vertices[0] = 0;
+		Boundaries[0] = -DBL_MAX;
+		Boundaries[1] = DBL_MAX;
+
+		for (int32 Q = 1; Q < Count; ++Q)
+		{
+			// Drop parabolas hidden by the new one; the first boundary is -DBL_MAX, so the first parabola always stays
+			double Intersection;
+			for (;;)
+			{
+				const int32 V = Vertices[NumParabolas];
+				Intersection = ((Values[Q] + (double)Q * Q) - (Values[V] + (double)V * V)) / (2.0 * (Q - V));
+				if (Intersection > Boundaries[NumParabolas])
+				{
+					break;
+				}
+				--NumParabolas;
+			}
+
+			++NumParabolas;
+			Vertices[NumParabolas] = Q;
+			Boundaries[NumParabolas] = Intersection;
+			Boundaries[NumParabolas + 1] = DBL_MAX;
+		}
+
+		int32 Parabola = 0;
+		for (int32 Q = 0; Q < Count; ++Q)
+		{
+			while (Boundaries[Parabola + 1] < Q)
+			{
+				++Parabola;
+			}
+			const int32 V = Vertices[Parabola];
+			Data[Q * Stride] = (float)((double)(Q - V) * (Q - V) + Values[V]);
+		}
+	}
+
+	/** Runs the transform over every column, then every row, of both fields. */
+	static bool TransformGrid(float* Grid, int32 Width, int32 Height, FQuickBakerCancellationToken& CancellationToken)
+	{
+		const int32 MaxCount = FMath::Max(Width, Height);
+
+		const bool bColumnsDone = CancellationToken.ParallelForRange(Width, [=](int64 Begin, int64 End)
+		{
+			TArray<float> Values;
+			TArray<int32> Vertices;
+			TArray<double> Boundaries;
+			Values.SetNumUninitialized(MaxCount);
+			Vertices.SetNumUninitialized(MaxCount);
+			Boundaries.SetNumUninitialized(MaxCount + 1);
+			for (int64 Column = Begin; Column < End; ++Column)
+			{
+				TransformLine(Grid + Column, Height, Width, Values.GetData(), Vertices.GetData(), Boundaries.GetData());
+			}
+		}, Height);
+		if (!bColumnsDone)
+		{
+			return false;
+		}
+
+		return CancellationToken.ParallelForRange(Height, [=](int64 Begin, int64 End)
+		{
+			TArray<float> Values;
+			TArray<int32> Vertices;
+			TArray<double> Boundaries;
+			Values.SetNumUninitialized(MaxCount);
+			Vertices.SetNumUninitialized(MaxCount);
+			Boundaries.SetNumUninitialized(MaxCount + 1);
+			for (int64 Row = Begin; Row < End; ++Row)
+			{
+				TransformLine(Grid + Row * Width, Width, 1, Values.GetData(), Vertices.GetData(), Boundaries.GetData());
+			}
+		}, Width);
+	}
+}
+
+bool FQuickBakerDistanceField::Generate(const float* Mask, int32 Width, int32 Height, float Threshold, float Spread, float* OutDistance, FQuickBakerCancellationToken& CancellationToken)
+{
+	using namespace QuickBakerDistanceField;
+
+	if (!Mask || !OutDistance || Width <= 0 || Height <= 0)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("DistanceField failed: Invalid image (%dx%d)."), Width, Height);
+		return false;
+	}
+
+	const int64 NumPixels = (int64)Width * Height;
+
+	// Squared distance to the nearest inside pixel, and to the nearest outside pixel
+	TArray64<float> ToInside;
+	TArray64<float> ToOutside;
+	ToInside.SetNumUninitialized(NumPixels);
+	ToOutside.SetNumUninitialized(NumPixels);
+	TArray64<bool> Inside;
+	Inside.SetNumUninitialized(NumPixels);
+
+	float* ToInsideData = ToInside.GetData();
+	float* ToOutsideData = ToOutside.GetData();
+	bool* InsideData = Inside.GetData();
+
+	if (!CancellationToken.ParallelForRange(NumPixels, [=](int64 Begin, int64 End)
+	{
+		for (int64 Index = Begin; Index < End; ++Index)
+		{
+			const bool bInside = Mask[Index] > Threshold;
+			InsideData[Index] = bInside;
+			ToInsideData[Index] = bInside ? 0.0f : NoSeed;
+			ToOutsideData[Index] = bInside ? NoSeed : 0.0f;
+		}
+	}))
+	{
+		return false;
+	}
+
+	if (!TransformGrid(ToInsideData, Width, Height, CancellationToken) || !TransformGrid(ToOutsideData, Width, Height, CancellationToken))
+	{
+		return false;
+	}
+
+	// The edge lies halfway between an inside pixel and its nearest outside pixel
+	const float InvSpread = 1.0f / FMath::Max(Spread, UE_KINDA_SMALL_NUMBER);
+	return CancellationToken.ParallelForRange(NumPixels, [=](int64 Begin, int64 End)
+	{
+		for (int64 Index = Begin; Index < End; ++Index)
+		{
+			const float Distance = InsideData[Index]
+				? FMath::Sqrt(ToOutsideData[Index]) - 0.5f
+				: 0.5f - FMath::Sqrt(ToInsideData[Index]);
+			OutDistance[Index] = FMath::Clamp(Distance * InvSpread, -1.0f, 1.0f);
+		}
+	});
+}
@@ -0,0 +1,499 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerDistributed.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerJobFile.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/Guid.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace QuickBakerDistributed
+{
+	/** Time the coordinator sleeps when no worker reported anything. */
+	static constexpr float PollSleepSeconds = 0.01f;
+
+	/** State of a job in the coordinator. */
+	enum class EJobState : uint8
+	{
+		Pending,
+		Succeeded,
+		Failed
+	};
+
+	/** A worker connection with the bytes received after its last complete line. */
+	struct FConnection
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> Buffer;
+	};
+
+	/** A running worker process and the jobs it has not reported yet. */
+	struct FWorker
+	{
+		int32 Id = 0;
+		FProcHandle Process;
+		TArray<int32> PendingJobs;
+		double LastReportTime = 0.0;
+		bool bExited = false;
+		bool bTimedOut = false;
+	};
+
+	/** Gets the editor executable that runs the workers. */
+	static FString GetWorkerExecutable()
+	{
+		FString Executable = FPlatformProcess::ExecutablePath();
+#if PLATFORM_WINDOWS
+		// The console build of the editor is the one meant for commandlets
+		const FString CmdExecutable = FPaths::Combine(FPaths::GetPath(Executable), FPaths::GetBaseFilename(Executable) + TEXT("-Cmd.exe"));
+		if (!FPaths::GetBaseFilename(Executable).EndsWith(TEXT("-Cmd")) && FPaths::FileExists(CmdExecutable))
+		{
+			Executable = CmdExecutable;
+		}
+#endif
+		return FPaths::ConvertRelativePathToFull(Executable);
+	}
+
+	/** Gets whether every worker runs on this machine, so the coordinator only needs to be reachable through loopback. */
+	static bool IsLocalOnly(const FQuickBakerDistributedOptions& Options)
+	{
+		return Options.NodeLaunchCommands.Num() == 0;
+	}
+
+	/** Writes a shard and starts a worker for it. */
+	static bool LaunchWorker(FWorker& Worker, TConstArrayView<FQuickBakerSettings> Jobs, const FQuickBakerDistributedOptions& Options, const FString& WorkDirectory, int32 Port, const FString& Token)
+	{
+		TArray<FQuickBakerSettings> ShardJobs;
+		for (const int32 JobIndex : Worker.PendingJobs)
+		{
+			ShardJobs.Add(Jobs[JobIndex]);
+		}
+
+		const FString ShardPath = FPaths::Combine(WorkDirectory, FString::Printf(TEXT("Shard_%d.json"), Worker.Id));
+		if (!FQuickBakerJobFile::Save(ShardPath, ShardJobs, Worker.PendingJobs, Token))
+		{
+			return false;
+		}
+
+		const FString Executable = GetWorkerExecutable();
+		const FString LogPath = FPaths::Combine(WorkDirectory, FString::Printf(TEXT("Worker_%d.log"), Worker.Id));
+		const FString CoordinatorAddress = IsLocalOnly(Options) ? FString(TEXT("127.0.0.1")) : Options.CoordinatorAddress;
+		FString Params = FString::Printf(TEXT("\"%s\" -run=QuickBaker -Jobs=\"%s\" -Coordinator=%s:%d -Worker=%d -Slots=%d -AllowCommandletRendering -RenderOffscreen -unattended -nopause -nosplash -abslog=\"%s\""),
+			*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), *ShardPath, *CoordinatorAddress, Port, Worker.Id, Options.NumSlotsPerWorker, *LogPath);
+
+		// On another node the launch command runs the editor with the same arguments
+		FString Program = Executable;
+		if (Options.NodeLaunchCommands.Num() > 0)
+		{
+			const FString& Command = Options.NodeLaunchCommands[Worker.Id % Options.NodeLaunchCommands.Num()];
+			FString CommandArgs;
+			if (!Command.TrimStartAndEnd().Split(TEXT(" "), &Program, &CommandArgs))
+			{
+				Program = Command.TrimStartAndEnd();
+			}
+			Params = FString::Printf(TEXT("%s \"%s\" %s"), *CommandArgs, *Executable, *Params);
+		}
+
+		Worker.Process = FPlatformProcess::CreateProc(*Program, *Params, false, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Worker.Process.IsValid())
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("Distributed batch: Could not start worker %d (%s)."), Worker.Id, *Program);
+			return false;
+		}
+
+		Worker.LastReportTime = FPlatformTime::Seconds();
+		UE_LOG(LogQuickBaker, Log, TEXT("Distributed batch: Started worker %d with %d jobs, log at %s."), Worker.Id, Worker.PendingJobs.Num(), *LogPath);
+		return true;
+	}
+
+	/** Sends one line, blocking until it is written. */
+	static bool SendLine(FSocket& Socket, const FString& Line)
+	{
+		const FTCHARToUTF8 Utf8(*(Line + TEXT("\n")));
+		const uint8* Data = (const uint8*)Utf8.Get();
+		int32 Remaining = Utf8.Length();
+		while (Remaining > 0)
+		{
+			int32 BytesSent = 0;
+			if (!Socket.Send(Data, Remaining, BytesSent) || BytesSent <= 0)
+			{
+				return false;
+			}
+			Data += BytesSent;
+			Remaining -= BytesSent;
+		}
+		return true;
+	}
+
+	/** Receives what a connection has pending and hands on each complete line. */
+	static bool ReceiveLines(FConnection& Connection, TFunctionRef<void(const FString&)> OnLine)
+	{
+		bool bReceived = false;
+		uint32 PendingSize = 0;
+		while (Connection.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+		{
+			const int32 Offset = Connection.Buffer.Num();
+			Connection.Buffer.AddUninitialized(PendingSize);
+
+			int32 BytesRead = 0;
+			Connection.Socket->Recv(Connection.Buffer.GetData() + Offset, PendingSize, BytesRead);
+			Connection.Buffer.SetNum(Offset + FMath::Max(BytesRead, 0), EAllowShrinking::No);
+			if (BytesRead <= 0)
+			{
+				break;
+			}
+			bReceived = true;
+		}
+
+		int32 LineEnd;
+		while (Connection.Buffer.Find((uint8)'\n', LineEnd))
+		{
+			const FUTF8ToTCHAR Converted((const ANSICHAR*)Connection.Buffer.GetData(), LineEnd);
+			OnLine(FString(Converted.Length(), Converted.Get()));
+			Connection.Buffer.RemoveAt(0, LineEnd + 1, EAllowShrinking::No);
+		}
+		return bReceived;
+	}
+}
+
+using namespace QuickBakerDistributed;
+
+FString FQuickBakerDistributedStats::ToString() const
+{
+	return FString::Printf(TEXT("%d/%d jobs succeeded, %d failed in %.2f s; %d workers started, %d crashed, %d timed out, %d jobs retried"),
+		NumSucceeded, NumJobs, NumFailed, TotalSeconds, NumWorkersLaunched, NumWorkerCrashes, NumWorkerTimeouts, NumRetriedJobs);
+}
+
+bool FQuickBakerDistributed::Execute(TConstArrayView<FQuickBakerSettings> Jobs, const FQuickBakerDistributedOptions& Options, FQuickBakerCancellationToken& CancellationToken, FQuickBakerDistributedStats& OutStats, const FQuickBakerBatchJobFinished& OnJobFinished)
+{
+	check(IsInGameThread());
+
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats = FQuickBakerDistributedStats();
+	OutStats.NumJobs = Jobs.Num();
+	if (Jobs.Num() == 0)
+	{
+		return true;
+	}
+
+	const FString WorkDirectory = FPaths::ConvertRelativePathToFull(Options.WorkDirectory.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("QuickBaker"), TEXT("Distributed"))
+		: Options.WorkDirectory);
+	IFileManager::Get().MakeDirectory(*WorkDirectory, true);
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	const int32 NumWorkers = FMath::Clamp(Options.NumWorkers, 1, Jobs.Num());
+
+	// Local workers connect through loopback, so other hosts cannot reach the coordinator at all
+	FSocket* Listener = FTcpSocketBuilder(TEXT("QuickBakerCoordinator"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToEndpoint(FIPv4Endpoint(IsLocalOnly(Options) ? FIPv4Address::InternalLoopback : FIPv4Address::Any, Options.Port))
+		.Listening(NumWorkers);
+	if (!Listener)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Distributed batch failed: Could not listen on port %d."), Options.Port);
+		OutStats.NumFailed = Jobs.Num();
+		return false;
+	}
+	const int32 Port = Listener->GetPortNo();
+
+	// Results must carry the secret written to this batch's shards, so a host that guesses worker and job ids
+	// still cannot report jobs
+	const FString Token = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+
+	TArray<EJobState> JobStates;
+	JobStates.Init(EJobState::Pending, Jobs.Num());
+	TArray<int32> JobRetries;
+	JobRetries.Init(0, Jobs.Num());
+	int32 NumFinished = 0;
+
+	auto FinishJob = [&](int32 JobIndex, bool bSuccess, double Seconds)
+	{
+		if (JobStates[JobIndex] != EJobState::Pending)
+		{
+			return;
+		}
+
+		JobStates[JobIndex] = bSuccess ? EJobState::Succeeded : EJobState::Failed;
+		++NumFinished;
+		if (bSuccess)
+		{
+			++OutStats.NumSucceeded;
+		}
+		else
+		{
+			++OutStats.NumFailed;
+		}
+
+		if (OnJobFinished)
+		{
+			OnJobFinished(JobIndex, bSuccess, Seconds);
+		}
+	};
+
+	TArray<FWorker> Workers;
+	int32 NextWorkerId = 0;
+	auto StartWorker = [&](TArray<int32>&& PendingJobs)
+	{
+		FWorker& Worker = Workers.AddDefaulted_GetRef();
+		Worker.Id = NextWorkerId++;
+		Worker.PendingJobs = MoveTemp(PendingJobs);
+		if (LaunchWorker(Worker, Jobs, Options, WorkDirectory, Port, Token))
+		{
+			++OutStats.NumWorkersLaunched;
+			return;
+		}
+
+		for (const int32 JobIndex : Worker.PendingJobs)
+		{
+			FinishJob(JobIndex, false, 0.0);
+		}
+		Workers.Pop();
+	};
+
+	// Jobs are dealt out in turn so that runs of similar settings spread over the workers
+	{
+		TArray<TArray<int32>> Shards;
+		Shards.SetNum(NumWorkers);
+		for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+		{
+			Shards[JobIndex % NumWorkers].Add(JobIndex);
+		}
+		for (TArray<int32>& Shard : Shards)
+		{
+			StartWorker(MoveTemp(Shard));
+		}
+	}
+
+	auto OnResultLine = [&](const FString& Line)
+	{
+		TSharedPtr<FJsonObject> Result;
+		int32 WorkerId = INDEX_NONE;
+		int32 JobIndex = INDEX_NONE;
+		bool bSuccess = false;
+		double Seconds = 0.0;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Result) || !Result.IsValid()
+			|| !Result->TryGetNumberField(TEXT("Worker"), WorkerId) || !Result->TryGetNumberField(TEXT("Job"), JobIndex)
+			|| !Result->TryGetBoolField(TEXT("Success"), bSuccess))
+		{
+			UE_LOG(LogQuickBaker, Warning, TEXT("Distributed batch: Ignoring malformed result: %s"), *Line);
+			return;
+		}
+		Result->TryGetNumberField(TEXT("Seconds"), Seconds);
+
+		FString LineToken;
+		if (!Result->TryGetStringField(TEXT("Token"), LineToken) || LineToken != Token)
+		{
+			UE_LOG(LogQuickBaker, Warning, TEXT("Distributed batch: Ignoring a result without this batch's token (worker %d, job %d)."), WorkerId, JobIndex);
+			return;
+		}
+
+		// Only the worker that currently owns a job may report it, so a late line from a replaced worker is dropped
+		FWorker* Worker = Workers.FindByPredicate([WorkerId](const FWorker& Candidate) { return Candidate.Id == WorkerId; });
+		if (Worker && Worker->PendingJobs.Remove(JobIndex) > 0)
+		{
+			Worker->LastReportTime = FPlatformTime::Seconds();
+			FinishJob(JobIndex, bSuccess, Seconds);
+		}
+	};
+
+	TArray<FConnection> Connections;
+	auto AcceptConnections = [&]()
+	{
+		bool bPendingConnection = false;
+		while (Listener->HasPendingConnection(bPendingConnection) && bPendingConnection)
+		{
+			if (FSocket* Socket = Listener->Accept(TEXT("QuickBakerWorker")))
+			{
+				Socket->SetNonBlocking(true);
+				Connections.Add({ Socket });
+			}
+		}
+	};
+
+	while (NumFinished < Jobs.Num())
+	{
+		if (CancellationToken.ShouldCancel())
+		{
+			break;
+		}
+
+		AcceptConnections();
+
+		// Exits are noted before the sockets are drained, so the last results a worker sent before exiting still count.
+		// A worker can connect, report and exit after the first accept, so connections are accepted again after the check.
+		for (FWorker& Worker : Workers)
+		{
+			Worker.bExited = !FPlatformProcess::IsProcRunning(Worker.Process);
+		}
+		AcceptConnections();
+
+		bool bProgress = false;
+		for (FConnection& Connection : Connections)
+		{
+			bProgress |= ReceiveLines(Connection, OnResultLine);
+		}
+
+		// A hung worker would block the batch forever, so it is terminated and its jobs are retried like after a crash
+		if (Options.WorkerTimeoutSeconds > 0.0)
+		{
+			const double Now = FPlatformTime::Seconds();
+			for (FWorker& Worker : Workers)
+			{
+				if (!Worker.bExited && Worker.PendingJobs.Num() > 0 && Now - Worker.LastReportTime > Options.WorkerTimeoutSeconds)
+				{
+					FPlatformProcess::TerminateProc(Worker.Process, true);
+					Worker.bExited = true;
+					Worker.bTimedOut = true;
+				}
+			}
+		}
+
+		for (int32 WorkerIndex = Workers.Num() - 1; WorkerIndex >= 0; --WorkerIndex)
+		{
+			if (!Workers[WorkerIndex].bExited)
+			{
+				continue;
+			}
+
+			FWorker Worker = MoveTemp(Workers[WorkerIndex]);
+			Workers.RemoveAt(WorkerIndex);
+			FPlatformProcess::CloseProc(Worker.Process);
+			bProgress = true;
+
+			if (Worker.PendingJobs.Num() == 0)
+			{
+				continue;
+			}
+
+			if (Worker.bTimedOut)
+			{
+				++OutStats.NumWorkerTimeouts;
+				UE_LOG(LogQuickBaker, Warning, TEXT("Distributed batch: Worker %d reported nothing for %.0f s and was terminated with %d jobs unreported."), Worker.Id, Options.WorkerTimeoutSeconds, Worker.PendingJobs.Num());
+			}
+			else
+			{
+				++OutStats.NumWorkerCrashes;
+				UE_LOG(LogQuickBaker, Warning, TEXT("Distributed batch: Worker %d exited with %d jobs unreported."), Worker.Id, Worker.PendingJobs.Num());
+			}
+
+			TArray<int32> RetryJobs;
+			for (const int32 JobIndex : Worker.PendingJobs)
+			{
+				if (JobRetries[JobIndex] < Options.MaxRetries)
+				{
+					++JobRetries[JobIndex];
+					RetryJobs.Add(JobIndex);
+				}
+				else
+				{
+					UE_LOG(LogQuickBaker, Error, TEXT("Distributed batch job %s failed: Its worker crashed or timed out %d times."), *Jobs[JobIndex].OutputName, JobRetries[JobIndex] + 1);
+					FinishJob(JobIndex, false, 0.0);
+				}
+			}
+
+			if (RetryJobs.Num() > 0)
+			{
+				OutStats.NumRetriedJobs += RetryJobs.Num();
+				StartWorker(MoveTemp(RetryJobs));
+			}
+		}
+
+		if (!bProgress)
+		{
+			FPlatformProcess::SleepNoStats(PollSleepSeconds);
+		}
+	}
+
+	// Only a cancel leaves workers running here
+	for (FWorker& Worker : Workers)
+	{
+		if (FPlatformProcess::IsProcRunning(Worker.Process))
+		{
+			FPlatformProcess::TerminateProc(Worker.Process, true);
+		}
+		FPlatformProcess::CloseProc(Worker.Process);
+	}
+
+	for (const FConnection& Connection : Connections)
+	{
+		Connection.Socket->Close();
+		SocketSubsystem->DestroySocket(Connection.Socket);
+	}
+	Listener->Close();
+	SocketSubsystem->DestroySocket(Listener);
+
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogQuickBaker, Log, TEXT("Distributed batch %s: %s"), CancellationToken.IsCanceled() ? TEXT("canceled") : TEXT("finished"), *OutStats.ToString());
+	return OutStats.NumSucceeded == Jobs.Num();
+}
+
+bool FQuickBakerDistributed::RunWorker(const FString& JobFilePath, const FString& CoordinatorAddress, int32 WorkerId, int32 NumSlots)
+{
+	TArray<FQuickBakerSettings> Jobs;
+	TArray<int32> JobIds;
+	FString Token;
+	if (!FQuickBakerJobFile::Load(JobFilePath, Jobs, &JobIds, &Token))
+	{
+		return false;
+	}
+
+	// The settings only hold weak pointers, so the loaded materials are kept alive for the whole shard
+	TArray<TStrongObjectPtr<UMaterialInterface>> Materials;
+	for (const FQuickBakerSettings& Settings : Jobs)
+	{
+		if (Settings.SelectedMaterial.IsValid())
+		{
+			Materials.Emplace(Settings.SelectedMaterial.Get());
+		}
+	}
+
+	FIPv4Endpoint Endpoint;
+	if (!FIPv4Endpoint::Parse(CoordinatorAddress, Endpoint))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Worker %d failed: Invalid coordinator address %s."), WorkerId, *CoordinatorAddress);
+		return false;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	FSocket* Socket = FTcpSocketBuilder(TEXT("QuickBakerWorker")).AsBlocking();
+	if (!Socket || !Socket->Connect(*Endpoint.ToInternetAddr()))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("Worker %d failed: Could not connect to the coordinator at %s."), WorkerId, *CoordinatorAddress);
+		if (Socket)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+		return false;
+	}
+
+	FQuickBakerCancellationToken CancellationToken;
+	FQuickBakerBatchStats Stats;
+	const bool bSuccess = FQuickBakerBatch::Execute(Jobs, CancellationToken, Stats, NumSlots,
+		[&](int32 JobIndex, bool bJobSuccess, double Seconds)
+		{
+			const FString Line = FString::Printf(TEXT("{\"Token\":\"%s\",\"Worker\":%d,\"Job\":%d,\"Success\":%s,\"Seconds\":%.4f}"),
+				*Token, WorkerId, JobIds[JobIndex], bJobSuccess ? TEXT("true") : TEXT("false"), Seconds);
+
+			// Without the coordinator the results cannot be delivered; it hands the jobs to another worker
+			if (!CancellationToken.IsCanceled() && !SendLine(*Socket, Line))
+			{
+				UE_LOG(LogQuickBaker, Error, TEXT("Worker %d: Lost the connection to the coordinator."), WorkerId);
+				CancellationToken.Cancel();
+			}
+		});
+
+	Socket->Close();
+	SocketSubsystem->DestroySocket(Socket);
+	return bSuccess;
+}
@@ -1,19 +1,110 @@
 // Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
 
 #include "QuickBakerExporter.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerFastFormats.h"
+#include "QuickBakerFileWriter.h"
+#include "QuickBakerReadback.h"
+#include "QuickBakerUtils.h"
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopedSlowTask.h"
 #include "RenderingThread.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY(LogQuickBaker);
 
 #define LOCTEXT_NAMESPACE "FQuickBakerExporter"
 
-bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, bool bIsPNG)
+namespace QuickBakerExporter
+{
+	static FLinearColor ToLinear(const FColor& Color) { return Color.ReinterpretAsLinear(); }
+	static FLinearColor ToLinear(const FFloat16Color& Color) { return Color.GetFloats(); }
+	static void FromLinear(const FLinearColor& Color, FColor& OutColor) { OutColor = Color.QuantizeRound(); }
+	static void FromLinear(const FLinearColor& Color, FFloat16Color& OutColor) { OutColor = FFloat16Color(Color); }
+
+	/**
+	 * Resamples six cube faces, laid out 3x2 in face order, into an equirectangular image (4 * FaceSize x 2 * FaceSize).
+	 * Longitude 0 faces +X and the top row is +Z, matching the engine's long-lat cubemap layout.
+	 * Returns false if the bake was canceled part way.
+	 */
+	template<typename PixelType>
+	static bool CubeFacesToEquirect(const TArray64<PixelType>& Faces, int32 FaceSize, TArray64<PixelType>& OutPixels, FIntPoint& OutSize, FQuickBakerCancellationToken& CancellationToken)
+	{
+		OutSize = FIntPoint(FaceSize * 4, FaceSize * 2);
+		OutPixels.SetNumUninitialized((int64)OutSize.X * OutSize.Y);
+
+		const int32 StripWidth = FaceSize * 3;
+		FVector Forward[6], Right[6], Down[6];
+		for (int32 FaceIndex = 0; FaceIndex < 6; ++FaceIndex)
+		{
+			FQuickBakerUtils::GetCubeFaceBasis(FaceIndex, Forward[FaceIndex], Right[FaceIndex], Down[FaceIndex]);
+		}
+
+		// Bilinear fetch clamped to the face, so samples never bleed into the neighbouring cell of the strip
+		auto SampleFace = [&Faces, FaceSize, StripWidth](int32 FaceIndex, double U, double V)
+		{
+			const int32 OriginX = (FaceIndex % 3) * FaceSize;
+			const int32 OriginY = (FaceIndex / 3) * FaceSize;
+			const double X = FMath::Clamp(U * FaceSize - 0.5, 0.0, FaceSize - 1.0);
+			const double Y = FMath::Clamp(V * FaceSize - 0.5, 0.0, FaceSize - 1.0);
+			const int32 X0 = FMath::FloorToInt32(X);
+			const int32 Y0 = FMath::FloorToInt32(Y);
+			const int32 X1 = FMath::Min(X0 + 1, FaceSize - 1);
+			const int32 Y1 = FMath::Min(Y0 + 1, FaceSize - 1);
+			const float FracX = (float)(X - X0);
+			const float FracY = (float)(Y - Y0);
+
+			auto Fetch = [&](int32 PX, int32 PY) { return ToLinear(Faces[(OriginY + PY) * StripWidth + OriginX + PX]); };
+			const FLinearColor Top = FMath::Lerp(Fetch(X0, Y0), Fetch(X1, Y0), FracX);
+			const FLinearColor Bottom = FMath::Lerp(Fetch(X0, Y1), Fetch(X1, Y1), FracX);
+			return FMath::Lerp(Top, Bottom, FracY);
+		};
+
+		const FIntPoint Size = OutSize;
+		PixelType* Dst = OutPixels.GetData();
+		return CancellationToken.ParallelForRange(Size.Y, [&](int64 BeginY, int64 EndY)
+		{
+			for (int64 Y = BeginY; Y < EndY; ++Y)
+			{
+				const double Latitude = UE_HALF_PI - (Y + 0.5) / Size.Y * UE_PI;
+				for (int32 X = 0; X < Size.X; ++X)
+				{
+					const double Longitude = (X + 0.5) / Size.X * UE_TWO_PI - UE_PI;
+					const FVector Direction(
+						FMath::Cos(Latitude) * FMath::Cos(Longitude),
+						FMath::Cos(Latitude) * FMath::Sin(Longitude),
+						FMath::Sin(Latitude));
+
+					// The face is picked by the dominant axis
+					const FVector Abs = Direction.GetAbs();
+					int32 FaceIndex;
+					if (Abs.X >= Abs.Y && Abs.X >= Abs.Z)
+					{
+						FaceIndex = Direction.X > 0.0 ? 0 : 1;
+					}
+					else if (Abs.Y >= Abs.Z)
+					{
+						FaceIndex = Direction.Y > 0.0 ? 2 : 3;
+					}
+					else
+					{
+						FaceIndex = Direction.Z > 0.0 ? 4 : 5;
+					}
+
+					const double Major = FVector::DotProduct(Direction, Forward[FaceIndex]);
+					const double U = (FVector::DotProduct(Direction, Right[FaceIndex]) / Major + 1.0) * 0.5;
+					const double V = (FVector::DotProduct(Direction, Down[FaceIndex]) / Major + 1.0) * 0.5;
+					FromLinear(SampleFace(FaceIndex, U, V), Dst[Y * Size.X + X]);
+				}
+			}
+		}, Size.X);
+	}
+}
+
+bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken)
 {
 	if (!RenderTarget)
 	{
@@ -21,7 +112,7 @@ bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, con
 		return false;
 	}
 
-	// Note: Caller (ExecuteBake) is responsible for calling FlushRenderingCommands() before invoking ExportToFile.
+	// Note: The readback is queued behind the caller's draw on the render thread, so no flush is needed before this.
 
 	FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
 	if (!RTResource)
@@ -30,31 +121,181 @@ bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, con
 		return false;
 	}
 
-	// Nested progress: 3 sub-phases (Read Pixels, Compress, Write File)
-	FScopedSlowTask SubTask(3.0f, bIsPNG
-		? LOCTEXT("ExportPNG", "Exporting PNG...")
-		: LOCTEXT("ExportEXR", "Exporting EXR..."));
+	// Nested progress: 2 sub-phases (Read Pixels, Compress & Write File)
+	FScopedSlowTask SubTask(2.0f, FText::Format(LOCTEXT("ExportFile", "Exporting {0}..."),
+		FText::FromString(FString(FQuickBakerSettings::GetFileExtension(OutputType)).ToUpper())));
 
-	FReadSurfaceDataFlags ReadPixelFlags(RCM_MinMax);
-	ReadPixelFlags.SetLinearToGamma(false);
+	// Sub-phase 1: Read pixels from render target
+	SubTask.EnterProgressFrame(1.0f, LOCTEXT("ReadingPixels_Export", "Reading pixels..."));
 
-	TArray<uint8> CompressedData;
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	// Staging rows are copied straight into the image buffer; no per-pixel surface conversion is involved
+	const int64 NumPixels = (int64)RenderTarget->SizeX * RenderTarget->SizeY;
+	const bool bIsFloat = RenderTarget->RenderTargetFormat == RTF_RGBA16f;
+
+	if (!bIsFloat)
+	{
+		// 8-bit export (PNG, QOI, TGA, and DDS/NPY/RAW at 8-bit)
+		TArray64<FColor> Bitmap;
+		Bitmap.SetNumUninitialized(NumPixels);
+		if (!FQuickBakerReadback::ReadColorPixels(RenderTarget, reinterpret_cast<uint8*>(Bitmap.GetData()), CancellationToken))
+		{
+			return false;
+		}
+
+		// Sub-phase 2: Compress and write
+		SubTask.EnterProgressFrame(1.0f);
+		return ExportPixelsToFile(Bitmap.GetData(), RenderTarget->SizeX, RenderTarget->SizeY, false, FullPath, OutputType, CancellationToken);
+	}
+	else
+	{
+		// 16-bit float export (EXR, and DDS/NPY/RAW at 16-bit), linear color space
+		// Read directly as FFloat16Color to avoid intermediate FLinearColor allocation (saves ~50% memory)
+		TArray64<FFloat16Color> Bitmap;
+		Bitmap.SetNumUninitialized(NumPixels);
+		if (!FQuickBakerReadback::ReadColorPixels(RenderTarget, reinterpret_cast<uint8*>(Bitmap.GetData()), CancellationToken))
+		{
+			return false;
+		}
+
+		// Sub-phase 2: Compress and write
+		SubTask.EnterProgressFrame(1.0f);
+		return ExportPixelsToFile(Bitmap.GetData(), RenderTarget->SizeX, RenderTarget->SizeY, true, FullPath, OutputType, CancellationToken);
+	}
+}
+
+bool FQuickBakerExporter::ExportCubemapToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken)
+{
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExportCubemapToFile failed: RenderTarget is null."));
+		return false;
+	}
+
+	FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!RTResource)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExportCubemapToFile failed: Could not get RenderTarget Resource from %s."), *RenderTarget->GetName());
+		return false;
+	}
+
+	const int32 FaceSize = RenderTarget->SizeY / 2;
+	if (FaceSize <= 0 || RenderTarget->SizeX != FaceSize * 3)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExportCubemapToFile failed: %dx%d is not a 3x2 face layout."), RenderTarget->SizeX, RenderTarget->SizeY);
+		return false;
+	}
+
+	// Nested progress: 3 sub-phases (Read Pixels, Unwrap, Compress & Write File)
+	FScopedSlowTask SubTask(3.0f, LOCTEXT("ExportCubemap", "Exporting equirectangular image..."));
+
+	// Exports started without a token still get the chunked write, they just cannot be canceled
+	FQuickBakerCancellationToken LocalToken;
+	FQuickBakerCancellationToken& Token = CancellationToken ? *CancellationToken : LocalToken;
 
-	// Sub-phase 1: Read pixels from render target
 	SubTask.EnterProgressFrame(1.0f, LOCTEXT("ReadingPixels_Export", "Reading pixels..."));
 
-	if (bIsPNG)
+	FIntPoint EquirectSize;
+	const int64 NumPixels = (int64)RenderTarget->SizeX * RenderTarget->SizeY;
+	if (RenderTarget->RenderTargetFormat != RTF_RGBA16f)
+	{
+		TArray64<FColor> Faces;
+		Faces.SetNumUninitialized(NumPixels);
+		if (!FQuickBakerReadback::ReadColorPixels(RenderTarget, reinterpret_cast<uint8*>(Faces.GetData()), &Token))
+		{
+			return false;
+		}
+
+		SubTask.EnterProgressFrame(1.0f, LOCTEXT("Unwrapping", "Unwrapping cubemap..."));
+		TArray64<FColor> Equirect;
+		if (!QuickBakerExporter::CubeFacesToEquirect(Faces, FaceSize, Equirect, EquirectSize, Token))
+		{
+			return false;
+		}
+		Faces.Empty();
+
+		SubTask.EnterProgressFrame(1.0f);
+		return ExportPixelsToFile(Equirect.GetData(), EquirectSize.X, EquirectSize.Y, false, FullPath, OutputType, &Token);
+	}
+	else
+	{
+		TArray64<FFloat16Color> Faces;
+		Faces.SetNumUninitialized(NumPixels);
+		if (!FQuickBakerReadback::ReadColorPixels(RenderTarget, reinterpret_cast<uint8*>(Faces.GetData()), &Token))
+		{
+			return false;
+		}
+
+		SubTask.EnterProgressFrame(1.0f, LOCTEXT("Unwrapping", "Unwrapping cubemap..."));
+		TArray64<FFloat16Color> Equirect;
+		if (!QuickBakerExporter::CubeFacesToEquirect(Faces, FaceSize, Equirect, EquirectSize, Token))
+		{
+			return false;
+		}
+		Faces.Empty();
+
+		SubTask.EnterProgressFrame(1.0f);
+		return ExportPixelsToFile(Equirect.GetData(), EquirectSize.X, EquirectSize.Y, true, FullPath, OutputType, &Token);
+	}
+}
+
+bool FQuickBakerExporter::ExportPixelsToFile(const void* Pixels, int32 Width, int32 Height, bool bIsFloat, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken)
+{
+	if (!Pixels || Width <= 0 || Height <= 0)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExportPixelsToFile failed: No pixel data for %s."), *FullPath);
+		return false;
+	}
+
+	// Nested progress: 2 sub-phases (Compress, Write File)
+	FScopedSlowTask SubTask(2.0f, FText::Format(LOCTEXT("ExportFile", "Exporting {0}..."),
+		FText::FromString(FString(FQuickBakerSettings::GetFileExtension(OutputType)).ToUpper())));
+
+	// Exports started without a token still get the chunked write, they just cannot be canceled
+	FQuickBakerCancellationToken LocalToken;
+	FQuickBakerCancellationToken& Token = CancellationToken ? *CancellationToken : LocalToken;
+
+	// The fast formats have no separate compression step; they stream straight to the file
+	if (FQuickBakerFastFormats::IsFastFormat(OutputType))
+	{
+		SubTask.EnterProgressFrame(2.0f, LOCTEXT("WritingFile", "Writing file to disk..."));
+		if (FQuickBakerFastFormats::WriteFile(Pixels, Width, Height, bIsFloat, OutputType, FullPath, Token))
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("Successfully exported texture to %s"), *FullPath);
+			return true;
+		}
+		if (Token.IsCanceled())
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("ExportToFile canceled: %s was not written."), *FullPath);
+		}
+		return false;
+	}
+
+	const bool bIsPNG = OutputType == EQuickBakerOutputType::PNG;
+	if (bIsPNG == bIsFloat || (!bIsPNG && OutputType != EQuickBakerOutputType::EXR))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ExportPixelsToFile failed: Pixel type does not match the output format for %s."), *FullPath);
+		return false;
+	}
+
+	// Image compression runs as one opaque call, so the check brackets it rather than interrupting it
+	if (Token.ShouldCancel())
 	{
-		// PNG Export (8-bit)
-		TArray<FColor> Bitmap;
-		RTResource->ReadPixels(Bitmap, ReadPixelFlags);
+		return false;
+	}
+
+	// Kept as TArray64, the encoder's own type, so the compressed image is never copied before it is written
+	TArray64<uint8> CompressedData;
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	const int64 NumPixels = (int64)Width * Height;
 
-		// Sub-phase 2: Compress image
+	if (bIsPNG)
+	{
+		// Sub-phase 1: Compress image
 		SubTask.EnterProgressFrame(1.0f, LOCTEXT("Compressing_PNG", "Compressing PNG..."));
 
 		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-		if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Bitmap.GetData(), (int64)Bitmap.Num() * sizeof(FColor), RenderTarget->SizeX, RenderTarget->SizeY, ERGBFormat::BGRA, 8))
+		if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Pixels, NumPixels * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
 		{
 			CompressedData = ImageWrapper->GetCompressed();
 		}
@@ -65,16 +306,11 @@ bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, con
 	}
 	else
 	{
-		// EXR Export (16-bit float, Linear color space)
-		// Read directly as FFloat16Color to avoid intermediate FLinearColor allocation (saves ~50% memory)
-		TArray<FFloat16Color> Bitmap;
-		RTResource->ReadFloat16Pixels(Bitmap);
-
-		// Sub-phase 2: Compress image
+		// Sub-phase 1: Compress image
 		SubTask.EnterProgressFrame(1.0f, LOCTEXT("Compressing_EXR", "Compressing EXR..."));
 
 		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::EXR);
-		if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Bitmap.GetData(), (int64)Bitmap.Num() * sizeof(FFloat16Color), RenderTarget->SizeX, RenderTarget->SizeY, ERGBFormat::RGBAF, 16))
+		if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Pixels, NumPixels * sizeof(FFloat16Color), Width, Height, ERGBFormat::RGBAF, 16))
 		{
 			CompressedData = ImageWrapper->GetCompressed();
 		}
@@ -84,16 +320,20 @@ bool FQuickBakerExporter::ExportToFile(UTextureRenderTarget2D* RenderTarget, con
 		}
 	}
 
-	// Sub-phase 3: Write file to disk
+	// Sub-phase 2: Write file to disk
 	SubTask.EnterProgressFrame(1.0f, LOCTEXT("WritingFile", "Writing file to disk..."));
 
 	if (CompressedData.Num() > 0)
 	{
-		if (FFileHelper::SaveArrayToFile(CompressedData, *FullPath))
+		if (FQuickBakerFileWriter::WriteFile(FullPath, CompressedData.GetData(), CompressedData.Num(), &Token))
 		{
 			UE_LOG(LogQuickBaker, Log, TEXT("Successfully exported texture to %s"), *FullPath);
 			return true;
 		}
+		else if (Token.IsCanceled())
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("ExportToFile canceled: %s was not written."), *FullPath);
+		}
 		else
 		{
 			UE_LOG(LogQuickBaker, Error, TEXT("ExportToFile failed: Could not write file to %s"), *FullPath);
@@ -0,0 +1,337 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerFastFormats.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerExporter.h"
+#include "QuickBakerFileWriter.h"
+
+namespace QuickBakerFastFormats
+{
+	/** Pixels converted per staging chunk (4 MB of 8-bit RGBA). */
+	static constexpr int64 PixelsPerChunk = 1 << 20;
+
+	/** Encoded bytes collected before QOI output is handed to the writer. */
+	static constexpr int32 QOIChunkBytes = 1 << 22;
+
+	/** Appends a value to a byte array in little-endian order. */
+	template<typename ValueType>
+	static void AppendLE(TArray<uint8>& Bytes, ValueType Value)
+	{
+		for (int32 Index = 0; Index < (int32)sizeof(ValueType); ++Index)
+		{
+			Bytes.Add((uint8)((uint64)Value >> (Index * 8)));
+		}
+	}
+
+	/** Appends a value to a byte array in big-endian order. */
+	static void AppendBE32(TArray<uint8>& Bytes, uint32 Value)
+	{
+		Bytes.Add((uint8)(Value >> 24));
+		Bytes.Add((uint8)(Value >> 16));
+		Bytes.Add((uint8)(Value >> 8));
+		Bytes.Add((uint8)Value);
+	}
+
+	/**
+	 * Streams 8-bit pixels as RGBA, converting from FColor's BGRA memory layout one staging chunk at a time.
+	 * The red/blue swap is a mask-and-shift per 32-bit pixel, which the compiler vectorizes.
+	 */
+	static bool WriteRGBA8(FQuickBakerFileWriter& Writer, const FColor* Pixels, int64 NumPixels, FQuickBakerCancellationToken& CancellationToken)
+	{
+		TArray64<uint32> Staging;
+		Staging.SetNumUninitialized(FMath::Min(NumPixels, PixelsPerChunk));
+
+		for (int64 ChunkBegin = 0; ChunkBegin < NumPixels; ChunkBegin += PixelsPerChunk)
+		{
+			const int64 ChunkPixels = FMath::Min(PixelsPerChunk, NumPixels - ChunkBegin);
+			const uint32* Src = reinterpret_cast<const uint32*>(Pixels + ChunkBegin);
+			uint32* Dst = Staging.GetData();
+			const bool bConverted = CancellationToken.ParallelForRange(ChunkPixels, [Src, Dst](int64 Begin, int64 End)
+			{
+				for (int64 Index = Begin; Index < End; ++Index)
+				{
+					const uint32 Value = Src[Index];
+					Dst[Index] = (Value & 0xFF00FF00u) | ((Value >> 16) & 0xFFu) | ((Value & 0xFFu) << 16);
+				}
+			});
+
+			if (!bConverted || !Writer.Write(Dst, ChunkPixels * sizeof(uint32), &CancellationToken))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Builds the 18-byte header of an uncompressed, top-left origin 32-bit TGA. */
+	static void BuildTGAHeader(TArray<uint8>& Header, int32 Width, int32 Height)
+	{
+		Header.AddZeroed(2);       // No image ID, no color map
+		Header.Add(2);             // Uncompressed true-color
+		Header.AddZeroed(5 + 4);   // Color map specification, X/Y origin
+		AppendLE<uint16>(Header, (uint16)Width);
+		AppendLE<uint16>(Header, (uint16)Height);
+		Header.Add(32);            // Bits per pixel
+		Header.Add(0x28);          // 8 alpha bits, top-left origin
+	}
+
+	/** Builds the TGA 2.0 footer, so readers do not mistake the file for the older TGA 1.0 layout. */
+	static void BuildTGAFooter(TArray<uint8>& Footer)
+	{
+		Footer.AddZeroed(8);       // No extension or developer area
+		const ANSICHAR Signature[] = "TRUEVISION-XFILE.";
+		Footer.Append(reinterpret_cast<const uint8*>(Signature), UE_ARRAY_COUNT(Signature));
+	}
+
+	/** Builds the magic and 124-byte header of a single-mip, uncompressed DDS. */
+	static void BuildDDSHeader(TArray<uint8>& Header, int32 Width, int32 Height, bool bIsFloat)
+	{
+		const uint32 BytesPerPixel = bIsFloat ? sizeof(FFloat16Color) : sizeof(FColor);
+
+		Header.Append(reinterpret_cast<const uint8*>("DDS "), 4);
+		AppendLE<uint32>(Header, 124);                        // dwSize
+		AppendLE<uint32>(Header, 0x1 | 0x2 | 0x4 | 0x8 | 0x1000); // CAPS | HEIGHT | WIDTH | PITCH | PIXELFORMAT
+		AppendLE<uint32>(Header, Height);
+		AppendLE<uint32>(Header, Width);
+		AppendLE<uint32>(Header, Width * BytesPerPixel);      // dwPitchOrLinearSize
+		AppendLE<uint32>(Header, 0);                          // dwDepth
+		AppendLE<uint32>(Header, 0);                          // dwMipMapCount
+		Header.AddZeroed(11 * sizeof(uint32));                // dwReserved1
+
+		// Pixel format: legacy BGRA8 masks, or the D3DFMT_A16B16G16R16F FourCC
+		AppendLE<uint32>(Header, 32);
+		if (bIsFloat)
+		{
+			AppendLE<uint32>(Header, 0x4);                    // DDPF_FOURCC
+			AppendLE<uint32>(Header, 113);
+			Header.AddZeroed(5 * sizeof(uint32));
+		}
+		else
+		{
+			AppendLE<uint32>(Header, 0x1 | 0x40);             // DDPF_ALPHAPIXELS | DDPF_RGB
+			AppendLE<uint32>(Header, 0);
+			AppendLE<uint32>(Header, 32);
+			AppendLE<uint32>(Header, 0x00FF0000);
+			AppendLE<uint32>(Header, 0x0000FF00);
+			AppendLE<uint32>(Header, 0x000000FF);
+			AppendLE<uint32>(Header, 0xFF000000);
+		}
+
+		AppendLE<uint32>(Header, 0x1000);                     // DDSCAPS_TEXTURE
+		Header.AddZeroed(4 * sizeof(uint32));                 // dwCaps2-4, dwReserved2
+	}
+
+	/** Builds a version 1.0 .npy header for a (Height, Width, 4) array, padded to a 64-byte boundary. */
+	static void BuildNPYHeader(TArray<uint8>& Header, int32 Width, int32 Height, bool bIsFloat)
+	{
+		const FString Dictionary = FString::Printf(TEXT("{'descr': '%s', 'fortran_order': False, 'shape': (%d, %d, 4), }"),
+			bIsFloat ? TEXT("<f2") : TEXT("|u1"), Height, Width);
+
+		// Magic (6) + version (2) + length (2) + dictionary + padding + newline
+		const int32 UnpaddedSize = 10 + Dictionary.Len() + 1;
+		const int32 Padding = Align(UnpaddedSize, 64) - UnpaddedSize;
+		const FString PaddedDictionary = Dictionary + FString::ChrN(Padding, TEXT(' ')) + TEXT("\n");
+
+		const ANSICHAR Magic[] = "\x93NUMPY";
+		Header.Append(reinterpret_cast<const uint8*>(Magic), 6);
+		Header.Add(1);
+		Header.Add(0);
+		AppendLE<uint16>(Header, (uint16)PaddedDictionary.Len());
+		const FTCHARToUTF8 Converted(*PaddedDictionary);
+		Header.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	/** Encodes 8-bit pixels as QOI, handing the output to the writer in chunks as it is produced. */
+	static bool WriteQOI(FQuickBakerFileWriter& Writer, const FColor* Pixels, int32 Width, int32 Height, FQuickBakerCancellationToken& CancellationToken)
+	{
+		TArray<uint8> Header;
+		Header.Append(reinterpret_cast<const uint8*>("qoif"), 4);
+		AppendBE32(Header, Width);
+		AppendBE32(Header, Height);
+		Header.Add(4); // RGBA
+		Header.Add(0); // sRGB color with linear alpha, as stored in the 8-bit render target
+		if (!Writer.Write(Header.GetData(), Header.Num(), &CancellationToken))
+		{
+			return false;
+		}
+
+		// A pixel emits at most six bytes (a pending run plus an RGBA op), so the slack keeps the chunk from overflowing
+		TArray<uint8> Chunk;
+		Chunk.SetNumUninitialized(QOIChunkBytes + 8);
+		uint8* Out = Chunk.GetData();
+		int32 Pos = 0;
+
+		FColor Index[64];
+		FMemory::Memzero(Index, sizeof(Index));
+		FColor Previous(0, 0, 0, 255);
+		int32 Run = 0;
+
+		const int64 NumPixels = (int64)Width * Height;
+		for (int64 PixelIndex = 0; PixelIndex < NumPixels; ++PixelIndex)
+		{
+			const FColor Pixel = Pixels[PixelIndex];
+			if (Pixel == Previous)
+			{
+				++Run;
+				if (Run == 62 || PixelIndex == NumPixels - 1)
+				{
+					Out[Pos++] = 0xC0 | (uint8)(Run - 1);
+					Run = 0;
+				}
+			}
+			else
+			{
+				if (Run > 0)
+				{
+					Out[Pos++] = 0xC0 | (uint8)(Run - 1);
+					Run = 0;
+				}
+
+				const int32 Hash = (Pixel.R * 3 + Pixel.G * 5 + Pixel.B * 7 + Pixel.A * 11) % 64;
+				if (Index[Hash] == Pixel)
+				{
+					Out[Pos++] = (uint8)Hash;
+				}
+				else
+				{
+					Index[Hash] = Pixel;
+					if (Pixel.A == Previous.A)
+					{
+						const int8 DR = (int8)(Pixel.R - Previous.R);
+						const int8 DG = (int8)(Pixel.G - Previous.G);
+						const int8 DB = (int8)(Pixel.B - Previous.B);
+						const int8 DRG = (int8)(DR - DG);
+						const int8 DBG = (int8)(DB - DG);
+
+						if (DR > -3 && DR < 2 && DG > -3 && DG < 2 && DB > -3 && DB < 2)
+						{
+							Out[Pos++] = 0x40 | (uint8)((DR + 2) << 4 | (DG + 2) << 2 | (DB + 2));
+						}
+						else if (DRG > -9 && DRG < 8 && DG > -33 && DG < 32 && DBG > -9 && DBG < 8)
+						{
+							Out[Pos++] = 0x80 | (uint8)(DG + 32);
+							Out[Pos++] = (uint8)((DRG + 8) << 4 | (DBG + 8));
+						}
+						else
+						{
+							Out[Pos++] = 0xFE;
+							Out[Pos++] = Pixel.R;
+							Out[Pos++] = Pixel.G;
+							Out[Pos++] = Pixel.B;
+						}
+					}
+					else
+					{
+						Out[Pos++] = 0xFF;
+						Out[Pos++] = Pixel.R;
+						Out[Pos++] = Pixel.G;
+						Out[Pos++] = Pixel.B;
+						Out[Pos++] = Pixel.A;
+					}
+				}
+			}
+			Previous = Pixel;
+
+			if (Pos >= QOIChunkBytes)
+			{
+				if (!Writer.Write(Out, Pos, &CancellationToken))
+				{
+					return false;
+				}
+				Pos = 0;
+			}
+		}
+
+		// End marker: seven zero bytes and a one
+		FMemory::Memzero(Out + Pos, 7);
+		Pos += 7;
+		Out[Pos++] = 1;
+		return Writer.Write(Out, Pos, &CancellationToken);
+	}
+}
+
+bool FQuickBakerFastFormats::IsFastFormat(EQuickBakerOutputType Type)
+{
+	return Type == EQuickBakerOutputType::QOI || Type == EQuickBakerOutputType::TGA || Type == EQuickBakerOutputType::DDS
+		|| Type == EQuickBakerOutputType::NPY || Type == EQuickBakerOutputType::RAW;
+}
+
+bool FQuickBakerFastFormats::WriteFile(const void* Pixels, int32 Width, int32 Height, bool bIsFloat, EQuickBakerOutputType Type, const FString& FullPath, FQuickBakerCancellationToken& CancellationToken)
+{
+	using namespace QuickBakerFastFormats;
+
+	if (!Pixels || Width <= 0 || Height <= 0 || !IsFastFormat(Type))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FastFormats failed: No pixel data or unsupported format for %s."), *FullPath);
+		return false;
+	}
+
+	if (bIsFloat && (Type == EQuickBakerOutputType::QOI || Type == EQuickBakerOutputType::TGA))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FastFormats failed: QOI and TGA only store 8-bit pixels (%s)."), *FullPath);
+		return false;
+	}
+
+	if (Type == EQuickBakerOutputType::TGA && (Width > MAX_uint16 || Height > MAX_uint16))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FastFormats failed: %dx%d exceeds the TGA size limit of 65535 (%s)."), Width, Height, *FullPath);
+		return false;
+	}
+
+	const int64 NumPixels = (int64)Width * Height;
+	const int64 PixelBytes = NumPixels * (bIsFloat ? sizeof(FFloat16Color) : sizeof(FColor));
+
+	TArray<uint8> Header;
+	TArray<uint8> Footer;
+	switch (Type)
+	{
+	case EQuickBakerOutputType::TGA:
+		BuildTGAHeader(Header, Width, Height);
+		BuildTGAFooter(Footer);
+		break;
+	case EQuickBakerOutputType::DDS:
+		BuildDDSHeader(Header, Width, Height, bIsFloat);
+		break;
+	case EQuickBakerOutputType::NPY:
+		BuildNPYHeader(Header, Width, Height, bIsFloat);
+		break;
+	default:
+		break;
+	}
+
+	// QOI's size is only known once encoded, so its file grows chunk by chunk
+	FQuickBakerFileWriter Writer(FullPath);
+	const int64 ExpectedSize = (Type == EQuickBakerOutputType::QOI) ? 0 : Header.Num() + PixelBytes + Footer.Num();
+	if (!Writer.Open(ExpectedSize))
+	{
+		return false;
+	}
+
+	bool bWritten = false;
+	if (Type == EQuickBakerOutputType::QOI)
+	{
+		bWritten = WriteQOI(Writer, static_cast<const FColor*>(Pixels), Width, Height, CancellationToken);
+	}
+	else if (Writer.Write(Header.GetData(), Header.Num(), &CancellationToken))
+	{
+		// TGA and DDS store BGRA like FColor, and every float layout is RGBA like FFloat16Color, so only
+		// 8-bit NumPy/raw output needs a conversion pass
+		const bool bNeedsSwizzle = !bIsFloat && (Type == EQuickBakerOutputType::NPY || Type == EQuickBakerOutputType::RAW);
+		bWritten = bNeedsSwizzle
+			? WriteRGBA8(Writer, static_cast<const FColor*>(Pixels), NumPixels, CancellationToken)
+			: Writer.Write(Pixels, PixelBytes, &CancellationToken);
+		bWritten = bWritten && Writer.Write(Footer.GetData(), Footer.Num(), &CancellationToken);
+	}
+
+	if (!bWritten)
+	{
+		Writer.Discard();
+		if (!CancellationToken.IsCanceled())
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("FastFormats failed: Could not write %s."), *FullPath);
+		}
+		return false;
+	}
+
+	return Writer.Commit();
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerFileWriter.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+
+namespace QuickBakerFileWriter
+{
+	/** Bytes handed to the OS per write call. Large writes keep the syscall count low and let the page cache coalesce. */
+	static constexpr int64 ChunkSize = 8 * 1024 * 1024;
+}
+
+FQuickBakerFileWriter::FQuickBakerFileWriter(const FString& InFullPath)
+	: FullPath(InFullPath)
+	, TempPath(InFullPath + TEXT(".tmp"))
+	, BytesWritten(0)
+{
+}
+
+FQuickBakerFileWriter::~FQuickBakerFileWriter()
+{
+	if (Handle)
+	{
+		Discard();
+	}
+}
+
+bool FQuickBakerFileWriter::Open(int64 ExpectedSize)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	const FString Directory = FPaths::GetPath(FullPath);
+	if (!Directory.IsEmpty() && !PlatformFile.CreateDirectoryTree(*Directory))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not create directory %s"), *Directory);
+		return false;
+	}
+
+	Handle.Reset(PlatformFile.OpenWrite(*TempPath, false, false));
+	if (!Handle)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not open %s for writing."), *TempPath);
+		return false;
+	}
+	BytesWritten = 0;
+
+	// Reserving the final size up front lets the file system allocate contiguous extents; failure is not fatal
+	if (ExpectedSize > 0)
+	{
+		Handle->Truncate(ExpectedSize);
+		Handle->Seek(0);
+	}
+
+	return true;
+}
+
+bool FQuickBakerFileWriter::Write(const void* Data, int64 NumBytes, FQuickBakerCancellationToken* CancellationToken)
+{
+	if (!Handle)
+	{
+		return false;
+	}
+
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+	for (int64 Offset = 0; Offset < NumBytes; Offset += QuickBakerFileWriter::ChunkSize)
+	{
+		if (CancellationToken && CancellationToken->ShouldCancel())
+		{
+			return false;
+		}
+
+		const int64 ChunkBytes = FMath::Min(QuickBakerFileWriter::ChunkSize, NumBytes - Offset);
+		if (!Handle->Write(Bytes + Offset, ChunkBytes))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Write error on %s after %lld bytes."), *TempPath, BytesWritten);
+			return false;
+		}
+		BytesWritten += ChunkBytes;
+	}
+
+	return true;
+}
+
+bool FQuickBakerFileWriter::Commit()
+{
+	if (!Handle)
+	{
+		return false;
+	}
+
+	// Drop any pre-sized tail that was not written
+	const bool bFlushed = Handle->Truncate(BytesWritten) && Handle->Flush();
+	Handle.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!bFlushed)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not finalize %s"), *TempPath);
+		PlatformFile.DeleteFile(*TempPath);
+		return false;
+	}
+
+	// The previous file is moved aside rather than deleted, so it can be put back if the new one cannot take its place
+	const FString BackupPath = FullPath + TEXT(".bak");
+	const bool bHasPrevious = PlatformFile.FileExists(*FullPath);
+	if (bHasPrevious)
+	{
+		PlatformFile.DeleteFile(*BackupPath);
+		if (!PlatformFile.MoveFile(*BackupPath, *FullPath))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not replace %s (file in use or read-only?)"), *FullPath);
+			PlatformFile.DeleteFile(*TempPath);
+			return false;
+		}
+	}
+
+	if (!PlatformFile.MoveFile(*FullPath, *TempPath))
+	{
+		if (bHasPrevious && !PlatformFile.MoveFile(*FullPath, *BackupPath))
+		{
+			// Neither file is at the destination: keep both on disk rather than lose the new image
+			UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not move %s to %s, nor restore the previous file from %s"), *TempPath, *FullPath, *BackupPath);
+			return false;
+		}
+
+		UE_LOG(LogQuickBaker, Error, TEXT("FileWriter failed: Could not move %s to %s; the previous file was kept."), *TempPath, *FullPath);
+		PlatformFile.DeleteFile(*TempPath);
+		return false;
+	}
+
+	if (bHasPrevious)
+	{
+		PlatformFile.DeleteFile(*BackupPath);
+	}
+	return true;
+}
+
+void FQuickBakerFileWriter::Discard()
+{
+	Handle.Reset();
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*TempPath);
+}
+
+bool FQuickBakerFileWriter::WriteFile(const FString& FullPath, const void* Data, int64 NumBytes, FQuickBakerCancellationToken* CancellationToken)
+{
+	FQuickBakerFileWriter Writer(FullPath);
+	if (!Writer.Open(NumBytes) || !Writer.Write(Data, NumBytes, CancellationToken))
+	{
+		Writer.Discard();
+		return false;
+	}
+	return Writer.Commit();
+}
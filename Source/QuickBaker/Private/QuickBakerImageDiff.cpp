@@ -0,0 +1,217 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerImageDiff.h"
+#include "ImageCore.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+#include <limits>
+
+namespace QuickBakerImageDiff
+{
+	/** Rows handed to a worker at once. */
+	static constexpr int32 RowsPerBlock = 32;
+
+	/** Differences of one block of rows, reduced after the parallel loop. */
+	struct FBlockResult
+	{
+		float MaxError = 0.0f;
+		FIntPoint MaxErrorPixel = FIntPoint(-1, -1);
+		double SumSquared = 0.0;
+		int64 NumDifferent = 0;
+	};
+
+	/** Gets a view of an image as 32-bit float RGBA, converting into Storage unless it already is. */
+	static FImageView ToFloatView(const FImageView& Image, FImage& Storage)
+	{
+		if (Image.Format == ERawImageFormat::RGBA32F)
+		{
+			return Image;
+		}
+
+		// Baked pixels are data, so 8-bit images are compared as stored rather than decoded from sRGB
+		FImageView StoredValues = Image;
+		StoredValues.GammaSpace = EGammaSpace::Linear;
+		StoredValues.CopyTo(Storage, ERawImageFormat::RGBA32F, EGammaSpace::Linear);
+		return Storage;
+	}
+
+	/** Loads one pixel as four floats: 8-bit BGRA scaled to 0-1, or float RGBA as is. */
+	template<bool bIsBytes>
+	static FORCEINLINE VectorRegister4Float LoadPixel(const uint8* Row, int32 X, const VectorRegister4Float& ByteScale)
+	{
+		if constexpr (bIsBytes)
+		{
+			return VectorMultiply(VectorLoadByte4(Row + X * 4), ByteScale);
+		}
+		else
+		{
+			return VectorLoad((const float*)Row + X * 4);
+		}
+	}
+
+	/** Gets the largest of the four components. */
+	static FORCEINLINE float GetMaxComponent(const VectorRegister4Float& Value)
+	{
+		float Components[4];
+		VectorStore(Value, Components);
+		return FMath::Max(FMath::Max(Components[0], Components[1]), FMath::Max(Components[2], Components[3]));
+	}
+
+	/** Compares rows [BeginY, EndY) of two images of the same format. */
+	template<bool bIsBytes>
+	static void CompareRows(const uint8* DataA, const uint8* DataB, int32 Width, int32 BeginY, int32 EndY, float PixelThreshold, FBlockResult& OutBlock)
+	{
+		const int64 RowBytes = (int64)Width * (bIsBytes ? 4 : 16);
+		const VectorRegister4Float ByteScale = VectorSetFloat1(1.0f / 255.0f);
+		const VectorRegister4Float Threshold = VectorSetFloat1(PixelThreshold);
+
+		for (int32 Y = BeginY; Y < EndY; ++Y)
+		{
+			const uint8* RowA = DataA + Y * RowBytes;
+			const uint8* RowB = DataB + Y * RowBytes;
+
+			VectorRegister4Float RowMax = VectorZeroFloat();
+			VectorRegister4Float RowSumSquared = VectorZeroFloat();
+			int64 RowDifferent = 0;
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const VectorRegister4Float Diff = VectorAbs(VectorSubtract(LoadPixel<bIsBytes>(RowA, X, ByteScale), LoadPixel<bIsBytes>(RowB, X, ByteScale)));
+				RowMax = VectorMax(RowMax, Diff);
+				RowSumSquared = VectorMultiplyAdd(Diff, Diff, RowSumSquared);
+				RowDifferent += VectorAnyGreaterThan(Diff, Threshold) ? 1 : 0;
+			}
+
+			float Sums[4];
+			VectorStore(RowSumSquared, Sums);
+			OutBlock.SumSquared += (double)Sums[0] + Sums[1] + Sums[2] + Sums[3];
+			OutBlock.NumDifferent += RowDifferent;
+
+			// A new maximum is rare, so its pixel is found by scanning the row again rather than tracked per pixel
+			const float RowMaxError = GetMaxComponent(RowMax);
+			if (RowMaxError > OutBlock.MaxError)
+			{
+				OutBlock.MaxError = RowMaxError;
+				for (int32 X = 0; X < Width; ++X)
+				{
+					const VectorRegister4Float Diff = VectorAbs(VectorSubtract(LoadPixel<bIsBytes>(RowA, X, ByteScale), LoadPixel<bIsBytes>(RowB, X, ByteScale)));
+					if (GetMaxComponent(Diff) == RowMaxError)
+					{
+						OutBlock.MaxErrorPixel = FIntPoint(X, Y);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	/** Maps an error in [0, 1] to black, red, yellow and white. */
+	static FColor GetHeatColor(float Error)
+	{
+		const float Scaled = FMath::Clamp(Error, 0.0f, 1.0f) * 3.0f;
+		return FColor(
+			(uint8)FMath::RoundToInt(FMath::Clamp(Scaled, 0.0f, 1.0f) * 255.0f),
+			(uint8)FMath::RoundToInt(FMath::Clamp(Scaled - 1.0f, 0.0f, 1.0f) * 255.0f),
+			(uint8)FMath::RoundToInt(FMath::Clamp(Scaled - 2.0f, 0.0f, 1.0f) * 255.0f),
+			255);
+	}
+
+	/** Gets whether two images can be compared. */
+	static bool HaveSameSize(const FImageView& A, const FImageView& B)
+	{
+		return A.SizeX > 0 && A.SizeY > 0 && A.NumSlices == 1 && B.NumSlices == 1 && A.SizeX == B.SizeX && A.SizeY == B.SizeY;
+	}
+}
+
+using namespace QuickBakerImageDiff;
+
+FString FQuickBakerImageDiffResult::ToString() const
+{
+	return FString::Printf(TEXT("PSNR %.2f dB, max error %.5f at (%d, %d), MSE %.3g, %lld pixels over threshold"),
+		PSNR, MaxError, MaxErrorPixel.X, MaxErrorPixel.Y, MeanSquaredError, NumDifferentPixels);
+}
+
+bool FQuickBakerImageDiff::Compare(const FImageView& A, const FImageView& B, FQuickBakerImageDiffResult& OutResult, float PixelThreshold)
+{
+	OutResult = FQuickBakerImageDiffResult();
+	if (!HaveSameSize(A, B))
+	{
+		return false;
+	}
+
+	// Two 8-bit images are read in place; anything else is compared as float
+	const bool bIsBytes = A.Format == ERawImageFormat::BGRA8 && B.Format == ERawImageFormat::BGRA8;
+	FImage StorageA;
+	FImage StorageB;
+	const FImageView ViewA = bIsBytes ? A : ToFloatView(A, StorageA);
+	const FImageView ViewB = bIsBytes ? B : ToFloatView(B, StorageB);
+
+	const int32 Width = A.SizeX;
+	const int32 Height = A.SizeY;
+	const int32 NumBlocks = FMath::DivideAndRoundUp(Height, RowsPerBlock);
+	TArray<FBlockResult, TInlineAllocator<128>> Blocks;
+	Blocks.SetNum(NumBlocks);
+
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
+	{
+		const int32 BeginY = BlockIndex * RowsPerBlock;
+		const int32 EndY = FMath::Min(BeginY + RowsPerBlock, Height);
+		const uint8* DataA = (const uint8*)ViewA.RawData;
+		const uint8* DataB = (const uint8*)ViewB.RawData;
+		if (bIsBytes)
+		{
+			CompareRows<true>(DataA, DataB, Width, BeginY, EndY, PixelThreshold, Blocks[BlockIndex]);
+		}
+		else
+		{
+			CompareRows<false>(DataA, DataB, Width, BeginY, EndY, PixelThreshold, Blocks[BlockIndex]);
+		}
+	});
+
+	double SumSquared = 0.0;
+	for (const FBlockResult& Block : Blocks)
+	{
+		SumSquared += Block.SumSquared;
+		OutResult.NumDifferentPixels += Block.NumDifferent;
+		if (Block.MaxError > OutResult.MaxError)
+		{
+			OutResult.MaxError = Block.MaxError;
+			OutResult.MaxErrorPixel = Block.MaxErrorPixel;
+		}
+	}
+
+	OutResult.MeanSquaredError = SumSquared / ((double)Width * Height * 4);
+	OutResult.PSNR = OutResult.MeanSquaredError > 0.0
+		? 10.0 * FMath::LogX(10.0, 1.0 / OutResult.MeanSquaredError)
+		: std::numeric_limits<double>::infinity();
+	return true;
+}
+
+bool FQuickBakerImageDiff::MakeHeatmap(const FImageView& A, const FImageView& B, float FullScaleError, FImage& OutHeatmap)
+{
+	if (!HaveSameSize(A, B))
+	{
+		return false;
+	}
+
+	FImage StorageA;
+	FImage StorageB;
+	const FImageView ViewA = ToFloatView(A, StorageA);
+	const FImageView ViewB = ToFloatView(B, StorageB);
+
+	OutHeatmap.Init(A.SizeX, A.SizeY, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+	const TArrayView64<FColor> Heat = OutHeatmap.AsBGRA8();
+	const TArrayView64<const FLinearColor> PixelsA = ViewA.AsRGBA32F();
+	const TArrayView64<const FLinearColor> PixelsB = ViewB.AsRGBA32F();
+	const float Scale = FullScaleError > 0.0f ? 1.0f / FullScaleError : 1.0f;
+
+	ParallelFor(A.SizeY, [&](int32 Y)
+	{
+		const int64 RowStart = (int64)Y * A.SizeX;
+		for (int64 Index = RowStart; Index < RowStart + A.SizeX; ++Index)
+		{
+			const VectorRegister4Float Diff = VectorAbs(VectorSubtract(VectorLoad(&PixelsA[Index].R), VectorLoad(&PixelsB[Index].R)));
+			Heat[Index] = GetHeatColor(GetMaxComponent(Diff) * Scale);
+		}
+	});
+	return true;
+}
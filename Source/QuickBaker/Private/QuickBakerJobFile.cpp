@@ -0,0 +1,360 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerJobFile.h"
+#include "QuickBakerExporter.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+
+namespace QuickBakerJobFile
+{
+	static const TCHAR* OutputTypeNames[] = { TEXT("Asset"), TEXT("PNG"), TEXT("EXR"), TEXT("QOI"), TEXT("TGA"), TEXT("DDS"), TEXT("NPY"), TEXT("RAW") };
+	static const TCHAR* BitDepthNames[] = { TEXT("Bit8"), TEXT("Bit16") };
+	static const TCHAR* UsageNames[] = { TEXT("Auto"), TEXT("Color"), TEXT("Normal"), TEXT("Mask"), TEXT("Data"), TEXT("UI"), TEXT("Effects") };
+	static const TCHAR* BakeModeNames[] = { TEXT("Single"), TEXT("Flipbook"), TEXT("Cubemap"), TEXT("UDIM") };
+	static const TCHAR* PostProcessTypeNames[] = { TEXT("SignedDistance"), TEXT("Dilate"), TEXT("Blur"), TEXT("Levels"), TEXT("Normalize") };
+
+	/** Gets the name of an enum value from its table. */
+	template<typename EnumType, int32 NumNames>
+	static FString EnumToString(EnumType Value, const TCHAR* (&Names)[NumNames])
+	{
+		const int32 Index = (int32)Value;
+		return Index < NumNames ? Names[Index] : TEXT("");
+	}
+
+	/** Reads an enum field by name. Leaves the value unchanged if the field is missing; fails on an unknown name. */
+	template<typename EnumType, int32 NumNames>
+	static bool ReadEnum(const FJsonObject& Object, const TCHAR* Field, const TCHAR* (&Names)[NumNames], EnumType& InOutValue)
+	{
+		FString Name;
+		if (!Object.TryGetStringField(Field, Name))
+		{
+			return true;
+		}
+
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			if (Name.Equals(Names[Index], ESearchCase::IgnoreCase))
+			{
+				InOutValue = (EnumType)Index;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Reads an optional integer field. */
+	static void ReadInt(const FJsonObject& Object, const TCHAR* Field, int32& InOutValue)
+	{
+		Object.TryGetNumberField(Field, InOutValue);
+	}
+
+	/** Reads an optional float field. */
+	static void ReadFloat(const FJsonObject& Object, const TCHAR* Field, float& InOutValue)
+	{
+		double Value;
+		if (Object.TryGetNumberField(Field, Value))
+		{
+			InOutValue = (float)Value;
+		}
+	}
+
+	/** Reads an optional name field. */
+	static void ReadName(const FJsonObject& Object, const TCHAR* Field, FName& InOutValue)
+	{
+		FString Value;
+		if (Object.TryGetStringField(Field, Value))
+		{
+			InOutValue = FName(*Value);
+		}
+	}
+
+	/** Converts a post-process stage to JSON. */
+	static TSharedRef<FJsonObject> StageToJson(const FQuickBakerPostProcessStage& Stage)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Type"), EnumToString(Stage.Type, PostProcessTypeNames));
+		Object->SetNumberField(TEXT("Radius"), Stage.Radius);
+		Object->SetNumberField(TEXT("Threshold"), Stage.Threshold);
+		Object->SetNumberField(TEXT("InBlack"), Stage.InBlack);
+		Object->SetNumberField(TEXT("InWhite"), Stage.InWhite);
+		Object->SetNumberField(TEXT("Gamma"), Stage.Gamma);
+		Object->SetNumberField(TEXT("OutBlack"), Stage.OutBlack);
+		Object->SetNumberField(TEXT("OutWhite"), Stage.OutWhite);
+		return Object;
+	}
+
+	/** Reads a post-process stage from JSON. */
+	static bool StageFromJson(const FJsonObject& Object, FQuickBakerPostProcessStage& OutStage)
+	{
+		if (!ReadEnum(Object, TEXT("Type"), PostProcessTypeNames, OutStage.Type))
+		{
+			return false;
+		}
+		ReadFloat(Object, TEXT("Radius"), OutStage.Radius);
+		ReadFloat(Object, TEXT("Threshold"), OutStage.Threshold);
+		ReadFloat(Object, TEXT("InBlack"), OutStage.InBlack);
+		ReadFloat(Object, TEXT("InWhite"), OutStage.InWhite);
+		ReadFloat(Object, TEXT("Gamma"), OutStage.Gamma);
+		ReadFloat(Object, TEXT("OutBlack"), OutStage.OutBlack);
+		ReadFloat(Object, TEXT("OutWhite"), OutStage.OutWhite);
+		return true;
+	}
+}
+
+using namespace QuickBakerJobFile;
+
+const TCHAR* FQuickBakerJobFile::GetOutputTypeName(EQuickBakerOutputType Type)
+{
+	return OutputTypeNames[(int32)Type];
+}
+
+const TCHAR* FQuickBakerJobFile::GetBakeModeName(EQuickBakerBakeMode Mode)
+{
+	return BakeModeNames[(int32)Mode];
+}
+
+TSharedRef<FJsonObject> FQuickBakerJobFile::ToJson(const FQuickBakerSettings& Settings)
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	Object->SetStringField(TEXT("Material"), Settings.SelectedMaterial.IsValid() ? Settings.SelectedMaterial->GetPathName() : FString());
+	Object->SetStringField(TEXT("OutputType"), GetOutputTypeName(Settings.OutputType));
+	Object->SetNumberField(TEXT("Width"), Settings.Width);
+	Object->SetNumberField(TEXT("Height"), Settings.Height);
+	Object->SetStringField(TEXT("BitDepth"), EnumToString(Settings.BitDepth, BitDepthNames));
+	Object->SetStringField(TEXT("Compression"), StaticEnum<TextureCompressionSettings>()->GetNameStringByValue(Settings.Compression));
+	Object->SetStringField(TEXT("Usage"), EnumToString(Settings.Usage, UsageNames));
+	Object->SetStringField(TEXT("BakeMode"), GetBakeModeName(Settings.BakeMode));
+	Object->SetNumberField(TEXT("FlipbookFrameCount"), Settings.FlipbookFrameCount);
+	Object->SetNumberField(TEXT("FlipbookColumns"), Settings.FlipbookColumns);
+	Object->SetNumberField(TEXT("FlipbookRows"), Settings.FlipbookRows);
+	Object->SetStringField(TEXT("TimeParameterName"), Settings.TimeParameterName.ToString());
+	Object->SetNumberField(TEXT("FlipbookDuration"), Settings.FlipbookDuration);
+	Object->SetStringField(TEXT("CubeFaceParameterPrefix"), Settings.CubeFaceParameterPrefix.ToString());
+	Object->SetNumberField(TEXT("UDIMTilesU"), Settings.UDIMTilesU);
+	Object->SetNumberField(TEXT("UDIMTilesV"), Settings.UDIMTilesV);
+	Object->SetBoolField(TEXT("bCompressSource"), Settings.bCompressSource);
+	Object->SetBoolField(TEXT("bSkipUnchangedAssets"), Settings.bSkipUnchangedAssets);
+	Object->SetNumberField(TEXT("UnchangedTolerance"), Settings.UnchangedTolerance);
+	Object->SetBoolField(TEXT("bAutoSelectFormat"), Settings.bAutoSelectFormat);
+	Object->SetBoolField(TEXT("bAllowRangeRemap"), Settings.bAllowRangeRemap);
+	Object->SetNumberField(TEXT("AutoFormatMaxError"), Settings.AutoFormatMaxError);
+
+	TArray<TSharedPtr<FJsonValue>> Stages;
+	for (const FQuickBakerPostProcessStage& Stage : Settings.PostProcessStages)
+	{
+		Stages.Add(MakeShared<FJsonValueObject>(StageToJson(Stage)));
+	}
+	Object->SetArrayField(TEXT("PostProcessStages"), Stages);
+
+	TArray<TSharedPtr<FJsonValue>> Variants;
+	for (const int32 VariantWidth : Settings.ResolutionVariants)
+	{
+		Variants.Add(MakeShared<FJsonValueNumber>(VariantWidth));
+	}
+	Object->SetArrayField(TEXT("ResolutionVariants"), Variants);
+
+	Object->SetStringField(TEXT("OutputName"), Settings.OutputName);
+	Object->SetStringField(TEXT("OutputPath"), Settings.OutputPath);
+
+	return Object;
+}
+
+bool FQuickBakerJobFile::FromJson(const FJsonObject& Object, FQuickBakerSettings& OutSettings, FString& OutError)
+{
+	OutSettings = FQuickBakerSettings();
+
+	if (!ReadEnum(Object, TEXT("OutputType"), OutputTypeNames, OutSettings.OutputType)
+		|| !ReadEnum(Object, TEXT("BitDepth"), BitDepthNames, OutSettings.BitDepth)
+		|| !ReadEnum(Object, TEXT("Usage"), UsageNames, OutSettings.Usage)
+		|| !ReadEnum(Object, TEXT("BakeMode"), BakeModeNames, OutSettings.BakeMode))
+	{
+		OutError = TEXT("Unknown enum value.");
+		return false;
+	}
+
+	FString CompressionName;
+	if (Object.TryGetStringField(TEXT("Compression"), CompressionName))
+	{
+		const int64 Value = StaticEnum<TextureCompressionSettings>()->GetValueByNameString(CompressionName);
+		if (Value == INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Unknown compression %s."), *CompressionName);
+			return false;
+		}
+		OutSettings.Compression = (TextureCompressionSettings)Value;
+	}
+
+	ReadInt(Object, TEXT("Width"), OutSettings.Width);
+	ReadInt(Object, TEXT("Height"), OutSettings.Height);
+	ReadInt(Object, TEXT("FlipbookFrameCount"), OutSettings.FlipbookFrameCount);
+	ReadInt(Object, TEXT("FlipbookColumns"), OutSettings.FlipbookColumns);
+	ReadInt(Object, TEXT("FlipbookRows"), OutSettings.FlipbookRows);
+	ReadName(Object, TEXT("TimeParameterName"), OutSettings.TimeParameterName);
+	ReadFloat(Object, TEXT("FlipbookDuration"), OutSettings.FlipbookDuration);
+	ReadName(Object, TEXT("CubeFaceParameterPrefix"), OutSettings.CubeFaceParameterPrefix);
+	ReadInt(Object, TEXT("UDIMTilesU"), OutSettings.UDIMTilesU);
+	ReadInt(Object, TEXT("UDIMTilesV"), OutSettings.UDIMTilesV);
+	Object.TryGetBoolField(TEXT("bCompressSource"), OutSettings.bCompressSource);
+	Object.TryGetBoolField(TEXT("bSkipUnchangedAssets"), OutSettings.bSkipUnchangedAssets);
+	ReadFloat(Object, TEXT("UnchangedTolerance"), OutSettings.UnchangedTolerance);
+	Object.TryGetBoolField(TEXT("bAutoSelectFormat"), OutSettings.bAutoSelectFormat);
+	Object.TryGetBoolField(TEXT("bAllowRangeRemap"), OutSettings.bAllowRangeRemap);
+	ReadFloat(Object, TEXT("AutoFormatMaxError"), OutSettings.AutoFormatMaxError);
+
+	const TArray<TSharedPtr<FJsonValue>>* Stages = nullptr;
+	if (Object.TryGetArrayField(TEXT("PostProcessStages"), Stages))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *Stages)
+		{
+			const TSharedPtr<FJsonObject>* StageObject = nullptr;
+			FQuickBakerPostProcessStage Stage;
+			if (!Value->TryGetObject(StageObject) || !StageFromJson(**StageObject, Stage))
+			{
+				OutError = TEXT("Invalid post-process stage.");
+				return false;
+			}
+			OutSettings.PostProcessStages.Add(Stage);
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Variants = nullptr;
+	if (Object.TryGetArrayField(TEXT("ResolutionVariants"), Variants))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *Variants)
+		{
+			int32 VariantWidth = 0;
+			if (Value->TryGetNumber(VariantWidth))
+			{
+				OutSettings.ResolutionVariants.Add(VariantWidth);
+			}
+		}
+	}
+
+	Object.TryGetStringField(TEXT("OutputName"), OutSettings.OutputName);
+	Object.TryGetStringField(TEXT("OutputPath"), OutSettings.OutputPath);
+
+	FString MaterialPath;
+	if (!Object.TryGetStringField(TEXT("Material"), MaterialPath) || MaterialPath.IsEmpty())
+	{
+		OutError = TEXT("No material.");
+		return false;
+	}
+
+	OutSettings.SelectedMaterial = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+	if (!OutSettings.SelectedMaterial.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Could not load material %s."), *MaterialPath);
+		return false;
+	}
+
+	return true;
+}
+
+bool FQuickBakerJobFile::Save(const FString& FilePath, TConstArrayView<FQuickBakerSettings> Jobs, TConstArrayView<int32> JobIds, const FString& Token)
+{
+	check(JobIds.Num() == 0 || JobIds.Num() == Jobs.Num());
+
+	TArray<TSharedPtr<FJsonValue>> JobValues;
+	for (int32 Index = 0; Index < Jobs.Num(); ++Index)
+	{
+		TSharedRef<FJsonObject> Job = MakeShared<FJsonObject>();
+		Job->SetNumberField(TEXT("Id"), JobIds.Num() > 0 ? JobIds[Index] : Index);
+		Job->SetObjectField(TEXT("Settings"), ToJson(Jobs[Index]));
+		JobValues.Add(MakeShared<FJsonValueObject>(Job));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), Version);
+	if (!Token.IsEmpty())
+	{
+		Root->SetStringField(TEXT("Token"), Token);
+	}
+	Root->SetArrayField(TEXT("Jobs"), JobValues);
+
+	FString Text;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Text, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Save failed: Could not write %s."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool FQuickBakerJobFile::Load(const FString& FilePath, TArray<FQuickBakerSettings>& OutJobs, TArray<int32>* OutJobIds, FString* OutToken)
+{
+	OutJobs.Reset();
+	if (OutJobIds)
+	{
+		OutJobIds->Reset();
+	}
+	if (OutToken)
+	{
+		OutToken->Reset();
+	}
+
+	FString Text;
+	if (!FFileHelper::LoadFileToString(Text, *FilePath))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Load failed: Could not read %s."), *FilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Load failed: %s is not valid JSON."), *FilePath);
+		return false;
+	}
+
+	int32 FileVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("Version"), FileVersion) || FileVersion <= 0 || FileVersion > Version)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Load failed: Unsupported version %d in %s."), FileVersion, *FilePath);
+		return false;
+	}
+
+	if (OutToken)
+	{
+		Root->TryGetStringField(TEXT("Token"), *OutToken);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JobValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("Jobs"), JobValues))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Load failed: No jobs in %s."), *FilePath);
+		return false;
+	}
+
+	for (int32 Index = 0; Index < JobValues->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* Job = nullptr;
+		const TSharedPtr<FJsonObject>* SettingsObject = nullptr;
+		int32 JobId = Index;
+
+		FQuickBakerSettings& Settings = OutJobs.AddDefaulted_GetRef();
+		if ((*JobValues)[Index]->TryGetObject(Job))
+		{
+			(*Job)->TryGetNumberField(TEXT("Id"), JobId);
+		}
+
+		FString Error = TEXT("Missing settings.");
+		if (!Job || !(*Job)->TryGetObjectField(TEXT("Settings"), SettingsObject) || !FromJson(**SettingsObject, Settings, Error))
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerJobFile::Load: Job %d of %s is invalid: %s"), JobId, *FilePath, *Error);
+			Settings.SelectedMaterial = nullptr;
+		}
+
+		if (OutJobIds)
+		{
+			OutJobIds->Add(JobId);
+		}
+	}
+
+	return true;
+}
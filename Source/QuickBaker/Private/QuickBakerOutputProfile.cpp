@@ -0,0 +1,234 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerOutputProfile.h"
+#include "QuickBakerProjectSettings.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureLODSettings.h"
+#include "Interfaces/ITargetPlatform.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+
+namespace QuickBakerOutputProfile
+{
+	/** Bits per pixel and block size of a texture format. */
+	struct FFormatSize
+	{
+		const TCHAR* Name;
+		int32 BitsPerPixel;
+		int32 BlockSize;
+	};
+
+	/** Formats the platforms compress baked textures to. Platform prefixes such as OODLE_ are ignored. */
+	static const FFormatSize FormatSizes[] =
+	{
+		{ TEXT("DXT1"), 4, 4 },
+		{ TEXT("DXT3"), 8, 4 },
+		{ TEXT("DXT5"), 8, 4 },
+		{ TEXT("AutoDXT"), 8, 4 },
+		{ TEXT("DXT5n"), 8, 4 },
+		{ TEXT("BC4"), 4, 4 },
+		{ TEXT("BC5"), 8, 4 },
+		{ TEXT("BC6H"), 8, 4 },
+		{ TEXT("BC7"), 8, 4 },
+		{ TEXT("ETC2_RGB"), 4, 4 },
+		{ TEXT("ETC2_RGBA"), 8, 4 },
+		{ TEXT("ETC2_R11"), 4, 4 },
+		{ TEXT("ETC2_RG11"), 8, 4 },
+		{ TEXT("AutoETC2"), 8, 4 },
+		{ TEXT("G8"), 8, 1 },
+		{ TEXT("G16"), 16, 1 },
+		{ TEXT("R16F"), 16, 1 },
+		{ TEXT("R32F"), 32, 1 },
+		{ TEXT("BGRA8"), 32, 1 },
+		{ TEXT("RGBA8"), 32, 1 },
+		{ TEXT("XGXR8"), 32, 1 },
+		{ TEXT("RGBA16F"), 64, 1 },
+		{ TEXT("RGBA32F"), 128, 1 },
+	};
+
+	/** Gets the size of a texture format, or false if it is unknown. */
+	static bool GetFormatSize(FName Format, int32& OutBitsPerPixel, int32& OutBlockSize)
+	{
+		const FString Name = Format.ToString();
+
+		// ASTC block sizes depend on the project's quality setting; 4x4 blocks are the largest
+		if (Name.Contains(TEXT("ASTC")))
+		{
+			OutBitsPerPixel = 8;
+			OutBlockSize = 4;
+			return true;
+		}
+
+		for (const FFormatSize& Size : FormatSizes)
+		{
+			if (Name.Equals(Size.Name, ESearchCase::IgnoreCase) || Name.EndsWith(FString(TEXT("_")) + Size.Name, ESearchCase::IgnoreCase))
+			{
+				OutBitsPerPixel = Size.BitsPerPixel;
+				OutBlockSize = Size.BlockSize;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Formats a byte count as KB or MB. */
+	static FString FormatBytes(int64 Bytes)
+	{
+		return Bytes >= 1024 * 1024
+			? FString::Printf(TEXT("%.1f MB"), Bytes / (1024.0 * 1024.0))
+			: FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0);
+	}
+}
+
+using namespace QuickBakerOutputProfile;
+
+EQuickBakerTextureUsage FQuickBakerOutputProfile::ResolveUsage(const FQuickBakerSettings& Settings)
+{
+	if (Settings.Usage != EQuickBakerTextureUsage::Auto)
+	{
+		return Settings.Usage;
+	}
+
+	if (Settings.BakeMode == EQuickBakerBakeMode::Flipbook)
+	{
+		return EQuickBakerTextureUsage::Effects;
+	}
+
+	switch (Settings.Compression)
+	{
+	case TC_Normalmap:
+		return EQuickBakerTextureUsage::Normal;
+	case TC_Grayscale:
+	case TC_Alpha:
+	case TC_Masks:
+		return EQuickBakerTextureUsage::Mask;
+	case TC_HDR:
+	case TC_HalfFloat:
+	case TC_SingleFloat:
+		return EQuickBakerTextureUsage::Data;
+	case TC_EditorIcon:
+		return EQuickBakerTextureUsage::UI;
+	default:
+		return EQuickBakerTextureUsage::Color;
+	}
+}
+
+bool FQuickBakerOutputProfile::FindRule(const FQuickBakerSettings& Settings, const FIntPoint& Size, FQuickBakerOutputRule& OutRule)
+{
+	const EQuickBakerTextureUsage Usage = ResolveUsage(Settings);
+	const int32 LargestDimension = FMath::Max(Size.X, Size.Y);
+
+	for (const FQuickBakerOutputRule& Rule : GetDefault<UQuickBakerProjectSettings>()->OutputRules)
+	{
+		if ((Rule.Usages.Num() == 0 || Rule.Usages.Contains(Usage))
+			&& LargestDimension >= Rule.MinSize
+			&& (Rule.MaxSize <= 0 || LargestDimension <= Rule.MaxSize))
+		{
+			OutRule = Rule;
+			return true;
+		}
+	}
+	return false;
+}
+
+void FQuickBakerOutputProfile::Apply(const FQuickBakerOutputRule* Rule, UTexture* Texture)
+{
+	if (!Rule)
+	{
+		Texture->MipGenSettings = TMGS_NoMipmaps;
+		return;
+	}
+
+	Texture->LODGroup = Rule->LODGroup;
+	Texture->MipGenSettings = Rule->MipGenSettings;
+	Texture->MaxTextureSize = Rule->MaxTextureSize;
+	Texture->LODBias = Rule->LODBias;
+	Texture->VirtualTextureStreaming = Rule->bVirtualTextureStreaming;
+	Texture->NeverStream = Rule->bNeverStream;
+}
+
+bool FQuickBakerOutputProfile::IsApplied(const FQuickBakerOutputRule* Rule, const UTexture* Texture)
+{
+	if (!Rule)
+	{
+		return Texture->MipGenSettings == TMGS_NoMipmaps;
+	}
+
+	return Texture->LODGroup == Rule->LODGroup
+		&& Texture->MipGenSettings == Rule->MipGenSettings
+		&& Texture->MaxTextureSize == Rule->MaxTextureSize
+		&& Texture->LODBias == Rule->LODBias
+		&& (bool)Texture->VirtualTextureStreaming == Rule->bVirtualTextureStreaming
+		&& (bool)Texture->NeverStream == Rule->bNeverStream;
+}
+
+TArray<FQuickBakerPlatformMemory> FQuickBakerOutputProfile::ProjectRuntimeMemory(const UTexture* Texture, const FIntPoint& Size, int32 NumSlices, int64 BudgetBytes)
+{
+	TArray<FQuickBakerPlatformMemory> Result;
+	ITargetPlatformManagerModule* PlatformManager = GetTargetPlatformManager();
+	if (!Texture || !PlatformManager || Size.X <= 0 || Size.Y <= 0)
+	{
+		return Result;
+	}
+
+	for (const FString& PlatformName : GetDefault<UQuickBakerProjectSettings>()->ReportPlatforms)
+	{
+		const ITargetPlatform* Platform = PlatformManager->FindTargetPlatform(PlatformName);
+		if (!Platform)
+		{
+			continue;
+		}
+
+		FQuickBakerPlatformMemory& Memory = Result.AddDefaulted_GetRef();
+		Memory.PlatformName = PlatformName;
+		Memory.bVirtual = Texture->VirtualTextureStreaming;
+
+		TArray<TArray<FName>> Formats;
+		Platform->GetTextureFormats(Texture, Formats);
+		Memory.TextureFormat = (Formats.Num() > 0 && Formats[0].Num() > 0) ? Formats[0][0] : NAME_None;
+
+		int32 BitsPerPixel = 32;
+		int32 BlockSize = 1;
+		Memory.bUnknownFormat = !GetFormatSize(Memory.TextureFormat, BitsPerPixel, BlockSize);
+
+		// Only power-of-two sources get a mip chain, and only a mip chain lets the platform drop top mips
+		const UTextureLODSettings& LODSettings = Platform->GetTextureLODSettings();
+		const TextureMipGenSettings MipGenSettings = Texture->MipGenSettings == TMGS_FromTextureGroup
+			? LODSettings.GetTextureMipGenSettings(Texture->LODGroup)
+			: Texture->MipGenSettings.GetValue();
+		const bool bHasMips = MipGenSettings != TMGS_NoMipmaps && FMath::IsPowerOfTwo(Size.X) && FMath::IsPowerOfTwo(Size.Y);
+		const int32 NumSourceMips = bHasMips ? FMath::FloorLog2(FMath::Max(Size.X, Size.Y)) + 1 : 1;
+		const int32 DroppedMips = bHasMips
+			? FMath::Clamp(LODSettings.CalculateLODBias(Size.X, Size.Y, Texture->MaxTextureSize, Texture->LODGroup, Texture->LODBias, 0, MipGenSettings, Texture->VirtualTextureStreaming), 0, NumSourceMips - 1)
+			: 0;
+
+		Memory.NumMips = NumSourceMips - DroppedMips;
+		Memory.ResidentSize = FIntPoint(FMath::Max(1, Size.X >> DroppedMips), FMath::Max(1, Size.Y >> DroppedMips));
+		for (int32 Mip = DroppedMips; Mip < NumSourceMips; ++Mip)
+		{
+			const int64 BlocksX = FMath::DivideAndRoundUp(FMath::Max(1, Size.X >> Mip), BlockSize);
+			const int64 BlocksY = FMath::DivideAndRoundUp(FMath::Max(1, Size.Y >> Mip), BlockSize);
+			Memory.Bytes += BlocksX * BlocksY * BlockSize * BlockSize * BitsPerPixel / 8;
+		}
+		Memory.Bytes *= NumSlices;
+		Memory.bOverBudget = BudgetBytes > 0 && Memory.Bytes > BudgetBytes;
+	}
+	return Result;
+}
+
+FString FQuickBakerOutputProfile::FormatMemoryReport(TConstArrayView<FQuickBakerPlatformMemory> Memory)
+{
+	FString Report;
+	for (const FQuickBakerPlatformMemory& Entry : Memory)
+	{
+		if (!Report.IsEmpty())
+		{
+			Report += TEXT("\n");
+		}
+		Report += FString::Printf(TEXT("%s: %s%s %dx%d, %d mips, %s%s%s"),
+			*Entry.PlatformName, *Entry.TextureFormat.ToString(), Entry.bUnknownFormat ? TEXT(" (size unknown, 32 bpp assumed)") : TEXT(""),
+			Entry.ResidentSize.X, Entry.ResidentSize.Y, Entry.NumMips, *FormatBytes(Entry.Bytes),
+			Entry.bVirtual ? TEXT(" in the virtual texture pool") : TEXT(""),
+			Entry.bOverBudget ? TEXT(" (over budget)") : TEXT(""));
+	}
+	return Report;
+}
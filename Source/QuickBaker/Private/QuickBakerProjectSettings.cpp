@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerProjectSettings.h"
+
+UQuickBakerProjectSettings::UQuickBakerProjectSettings()
+{
+	// Default rules: exact-sampled textures first, then very large bakes, then one rule per usage
+	FQuickBakerOutputRule UI;
+	UI.Name = TEXT("UI");
+	UI.Usages = { EQuickBakerTextureUsage::UI };
+	UI.LODGroup = TEXTUREGROUP_UI;
+	UI.MipGenSettings = TMGS_NoMipmaps;
+	UI.bNeverStream = true;
+	OutputRules.Add(UI);
+
+	FQuickBakerOutputRule Data;
+	Data.Name = TEXT("Data");
+	Data.Usages = { EQuickBakerTextureUsage::Data };
+	Data.LODGroup = TEXTUREGROUP_16BitData;
+	Data.MipGenSettings = TMGS_NoMipmaps;
+	Data.bNeverStream = true;
+	OutputRules.Add(Data);
+
+	FQuickBakerOutputRule Virtual;
+	Virtual.Name = TEXT("Virtual");
+	Virtual.MinSize = 8192;
+	Virtual.bVirtualTextureStreaming = true;
+	OutputRules.Add(Virtual);
+
+	FQuickBakerOutputRule Normal;
+	Normal.Name = TEXT("Normal");
+	Normal.Usages = { EQuickBakerTextureUsage::Normal };
+	Normal.LODGroup = TEXTUREGROUP_WorldNormalMap;
+	Normal.MaxTextureSize = 2048;
+	OutputRules.Add(Normal);
+
+	FQuickBakerOutputRule Mask;
+	Mask.Name = TEXT("Mask");
+	Mask.Usages = { EQuickBakerTextureUsage::Mask };
+	Mask.LODGroup = TEXTUREGROUP_WorldSpecular;
+	Mask.MaxTextureSize = 2048;
+	OutputRules.Add(Mask);
+
+	FQuickBakerOutputRule Effects;
+	Effects.Name = TEXT("Effects");
+	Effects.Usages = { EQuickBakerTextureUsage::Effects };
+	Effects.LODGroup = TEXTUREGROUP_Effects;
+	Effects.MaxTextureSize = 2048;
+	OutputRules.Add(Effects);
+
+	FQuickBakerOutputRule Color;
+	Color.Name = TEXT("Color");
+	Color.Usages = { EQuickBakerTextureUsage::Color };
+	Color.LODGroup = TEXTUREGROUP_World;
+	Color.MaxTextureSize = 4096;
+	OutputRules.Add(Color);
+
+	ReportPlatforms = { TEXT("Windows"), TEXT("Linux"), TEXT("Android"), TEXT("IOS") };
+}
@@ -0,0 +1,294 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerReadback.h"
+#include "QuickBakerBakeHistory.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "Async/ParallelFor.h"
+
+namespace QuickBakerReadback
+{
+	/** Copies mapped staging rows, padded to the GPU's pitch alignment, to their packed positions. */
+	static void CopyPackedRows(const uint8* SrcData, int32 RowPitchInPixels, uint8* DstData, const FIntPoint& Size, int32 BytesPerPixel)
+	{
+		const int64 SrcRowBytes = (int64)RowPitchInPixels * BytesPerPixel;
+		const int64 DstRowBytes = (int64)Size.X * BytesPerPixel;
+		if (SrcRowBytes == DstRowBytes)
+		{
+			FMemory::Memcpy(DstData, SrcData, DstRowBytes * Size.Y);
+		}
+		else
+		{
+			ParallelFor(Size.Y, [SrcData, DstData, SrcRowBytes, DstRowBytes](int32 Row)
+			{
+				FMemory::Memcpy(DstData + Row * DstRowBytes, SrcData + Row * SrcRowBytes, DstRowBytes);
+			});
+		}
+	}
+}
+
+bool FQuickBakerReadback::ReadRawPixels(UTextureRenderTarget2D* RenderTarget, TArray64<uint8>& OutData, EPixelFormat& OutFormat, const FQuickBakerCancellationToken* CancellationToken)
+{
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadRawPixels failed: RenderTarget is null."));
+		return false;
+	}
+
+	const EPixelFormat PixelFormat = GetPixelFormatFromRenderTargetFormat(RenderTarget->RenderTargetFormat);
+	OutData.SetNumUninitialized((int64)RenderTarget->SizeX * RenderTarget->SizeY * GPixelFormats[PixelFormat].BlockBytes);
+
+	if (!ReadRawPixels(RenderTarget, OutData.GetData(), OutFormat, CancellationToken))
+	{
+		OutData.Empty();
+		return false;
+	}
+	return true;
+}
+
+bool FQuickBakerReadback::ReadRawPixels(UTextureRenderTarget2D* RenderTarget, uint8* DstData, EPixelFormat& OutFormat, const FQuickBakerCancellationToken* CancellationToken)
+{
+	using namespace QuickBakerReadback;
+
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadRawPixels failed: RenderTarget is null."));
+		return false;
+	}
+
+	FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!RTResource)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadRawPixels failed: Could not get RenderTarget Resource from %s."), *RenderTarget->GetName());
+		return false;
+	}
+
+	const FIntPoint Size(RenderTarget->SizeX, RenderTarget->SizeY);
+	const EPixelFormat PixelFormat = GetPixelFormatFromRenderTargetFormat(RenderTarget->RenderTargetFormat);
+	const int32 BytesPerPixel = GPixelFormats[PixelFormat].BlockBytes;
+
+	OutFormat = PixelFormat;
+
+	bool bSuccess = false;
+
+	ENQUEUE_RENDER_COMMAND(QuickBakerReadRawPixels)(
+		[RTResource, Size, BytesPerPixel, DstData, CancellationToken, &OutFormat, &bSuccess](FRHICommandListImmediate& RHICmdList)
+		{
+			FRHITexture* Texture = RTResource->GetRenderTargetTexture();
+
+			// Report the format the RHI actually allocated; channel order can differ from the requested one
+			if (GPixelFormats[Texture->GetFormat()].BlockBytes == BytesPerPixel)
+			{
+				OutFormat = Texture->GetFormat();
+			}
+
+			// The copy goes through a render graph so it picks up the target in whatever state the draw graph left it
+			FRHIGPUTextureReadback Readback(TEXT("QuickBakerReadback"));
+			{
+				FRDGBuilder GraphBuilder(RHICmdList, RDG_EVENT_NAME("QuickBakerReadback"));
+				AddEnqueueCopyPass(GraphBuilder, &Readback, RegisterExternalTexture(GraphBuilder, Texture, TEXT("QuickBakerReadbackSource")));
+				GraphBuilder.Execute();
+			}
+
+			// The bake is synchronous, so wait here instead of polling IsReady() across frames
+			RHICmdList.SubmitCommandsAndFlushGPU();
+			RHICmdList.BlockUntilGPUIdle();
+
+			// The render thread cannot poll the progress dialog, but it still honours a cancel requested before it got here
+			if (CancellationToken && CancellationToken->IsCanceled())
+			{
+				return;
+			}
+
+			int32 RowPitchInPixels = 0;
+			const uint8* SrcData = static_cast<const uint8*>(Readback.Lock(RowPitchInPixels));
+			if (!SrcData)
+			{
+				return;
+			}
+
+			CopyPackedRows(SrcData, RowPitchInPixels, DstData, Size, BytesPerPixel);
+			Readback.Unlock();
+			bSuccess = true;
+		});
+
+	FlushRenderingCommands();
+
+	if (bSuccess)
+	{
+		// The destination holds the whole image now, so this is the high point of the bake's host memory
+		FQuickBakerHostMemoryScope::Sample();
+	}
+	else if (!(CancellationToken && CancellationToken->IsCanceled()))
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadRawPixels failed: Could not map readback buffer for %s."), *RenderTarget->GetName());
+	}
+
+	return bSuccess;
+}
+
+bool FQuickBakerReadback::ReadColorPixels(UTextureRenderTarget2D* RenderTarget, uint8* DstData, const FQuickBakerCancellationToken* CancellationToken)
+{
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadColorPixels failed: RenderTarget is null."));
+		return false;
+	}
+
+	const ETextureRenderTargetFormat Format = RenderTarget->RenderTargetFormat;
+	if (Format != RTF_RGBA8 && Format != RTF_RGBA16f)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadColorPixels failed: %s is not an RGBA8 or RGBA16f render target."), *RenderTarget->GetName());
+		return false;
+	}
+
+	EPixelFormat PixelFormat;
+	if (!ReadRawPixels(RenderTarget, DstData, PixelFormat, CancellationToken))
+	{
+		return false;
+	}
+
+	return ConvertToColorPixels(DstData, (int64)RenderTarget->SizeX * RenderTarget->SizeY, PixelFormat);
+}
+
+bool FQuickBakerReadback::ConvertToColorPixels(uint8* Data, int64 NumPixels, EPixelFormat PixelFormat)
+{
+	// FColor is BGRA in memory; only an RGBA-ordered GPU format needs the red/blue swap
+	if (PixelFormat == PF_R8G8B8A8)
+	{
+		constexpr int64 PixelsPerTask = 1 << 16;
+		uint32* Pixels = reinterpret_cast<uint32*>(Data);
+		ParallelFor((int32)FMath::DivideAndRoundUp(NumPixels, PixelsPerTask), [Pixels, NumPixels](int32 TaskIndex)
+		{
+			const int64 Begin = TaskIndex * PixelsPerTask;
+			const int64 End = FMath::Min(Begin + PixelsPerTask, NumPixels);
+			// Branch-free mask and shift per pixel, which the compiler turns into SIMD
+			for (int64 Index = Begin; Index < End; ++Index)
+			{
+				const uint32 Pixel = Pixels[Index];
+				Pixels[Index] = (Pixel & 0xFF00FF00u) | ((Pixel & 0x00FF0000u) >> 16) | ((Pixel & 0x000000FFu) << 16);
+			}
+		});
+	}
+	else if (PixelFormat != PF_B8G8R8A8 && PixelFormat != PF_FloatRGBA)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("ReadColorPixels failed: Unexpected pixel format %s."), GPixelFormats[PixelFormat].Name);
+		return false;
+	}
+
+	return true;
+}
+
+FQuickBakerAsyncReadback::FQuickBakerAsyncReadback()
+	: Readback(MakeUnique<FRHIGPUTextureReadback>(TEXT("QuickBakerAsyncReadback")))
+	, State(EState::Idle)
+	, bCheckQueued(false)
+	, PixelFormat(PF_Unknown)
+{
+}
+
+FQuickBakerAsyncReadback::~FQuickBakerAsyncReadback()
+{
+	// Queued copies and checks reference this object
+	if (State.load() == EState::Pending || bCheckQueued.load())
+	{
+		FlushRenderingCommands();
+	}
+}
+
+FQuickBakerGraphPasses FQuickBakerAsyncReadback::Begin(const FIntPoint& Size, int32 BytesPerPixel, uint8* DstData)
+{
+	check(IsInGameThread());
+	check(State.load() != EState::Pending);
+
+	State = EState::Pending;
+	PixelFormat = PF_Unknown;
+
+	return [this, Size, BytesPerPixel, DstData](FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)
+	{
+		if (GPixelFormats[BakeTarget->Desc.Format].BlockBytes != BytesPerPixel || BakeTarget->Desc.Extent != Size)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("FQuickBakerAsyncReadback failed: The bake target does not match the destination buffer."));
+			State = EState::Failed;
+			return;
+		}
+
+		PixelFormat = BakeTarget->Desc.Format;
+		Destination = DstData;
+		DestinationSize = Size;
+		DestinationBytesPerPixel = BytesPerPixel;
+		AddEnqueueCopyPass(GraphBuilder, Readback.Get(), BakeTarget);
+	};
+}
+
+bool FQuickBakerAsyncReadback::Poll()
+{
+	using namespace QuickBakerReadback;
+	check(IsInGameThread());
+
+	if (State.load() != EState::Pending)
+	{
+		const bool bComplete = State.load() == EState::Complete;
+		if (bComplete)
+		{
+			FQuickBakerHostMemoryScope::Sample();
+		}
+		return bComplete;
+	}
+
+	// One check in flight at a time; the render thread answers it after the commands queued before it
+	if (!bCheckQueued.exchange(true))
+	{
+		ENQUEUE_RENDER_COMMAND(QuickBakerPollReadback)(
+			[this](FRHICommandListImmediate& RHICmdList)
+			{
+				if (State.load() == EState::Pending)
+				{
+					if (Readback->IsReady())
+					{
+						int32 RowPitchInPixels = 0;
+						const uint8* SrcData = static_cast<const uint8*>(Readback->Lock(RowPitchInPixels));
+						if (SrcData)
+						{
+							CopyPackedRows(SrcData, RowPitchInPixels, Destination, DestinationSize, DestinationBytesPerPixel);
+							Readback->Unlock();
+							State = EState::Complete;
+						}
+						else
+						{
+							State = EState::Failed;
+						}
+					}
+					else
+					{
+						// Recorded copies may still sit in the command list; hand them to the GPU instead of waiting for the next frame
+						RHICmdList.SubmitCommandsHint();
+					}
+				}
+				bCheckQueued = false;
+			});
+	}
+
+	return false;
+}
+
+void FQuickBakerAsyncReadback::Reset()
+{
+	check(IsInGameThread());
+	State = EState::Idle;
+}
+
+bool FQuickBakerAsyncReadback::HasFailed() const
+{
+	return State.load() == EState::Failed;
+}
+
+EPixelFormat FQuickBakerAsyncReadback::GetPixelFormat() const
+{
+	return PixelFormat;
+}
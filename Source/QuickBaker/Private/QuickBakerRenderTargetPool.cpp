@@ -0,0 +1,131 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerRenderTargetPool.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+#include "UObject/Package.h"
+
+namespace QuickBakerRenderTargetPool
+{
+	/** Upper bound for GPU memory held by idle render targets (an 8k RGBA16f target is 512 MB). */
+	static constexpr int64 MaxIdleBytes = 512ll * 1024 * 1024;
+
+	/** Idle render targets, oldest first. Every entry is rooted. */
+	static TArray<UTextureRenderTarget2D*> IdleTargets;
+
+	/** Acquire calls served by an idle target and by a new one, for bake history records. */
+	static int32 NumHits = 0;
+	static int32 NumMisses = 0;
+
+	static void FreeTarget(UTextureRenderTarget2D* RenderTarget)
+	{
+		RenderTarget->ReleaseResource();
+		RenderTarget->RemoveFromRoot();
+		RenderTarget->MarkAsGarbage();
+	}
+}
+
+UTextureRenderTarget2D* FQuickBakerRenderTargetPool::Acquire(int32 SizeX, int32 SizeY, ETextureRenderTargetFormat Format)
+{
+	using namespace QuickBakerRenderTargetPool;
+	check(IsInGameThread());
+
+	// Reuse the most recently released match, which is the most likely to still be resident
+	for (int32 Index = IdleTargets.Num() - 1; Index >= 0; --Index)
+	{
+		UTextureRenderTarget2D* Candidate = IdleTargets[Index];
+		if (Candidate->SizeX == SizeX && Candidate->SizeY == SizeY && Candidate->RenderTargetFormat == Format)
+		{
+			IdleTargets.RemoveAt(Index, 1, EAllowShrinking::No);
+			++NumHits;
+			return Candidate;
+		}
+	}
+
+	UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(
+		GetTransientPackage(),
+		NAME_None,
+		RF_Transient
+	);
+
+	if (!RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("RenderTargetPool: Failed to create %dx%d render target."), SizeX, SizeY);
+		return nullptr;
+	}
+
+	// GC Protection: pooled targets stay rooted until they are freed.
+	RenderTarget->AddToRoot();
+	++NumMisses;
+
+	RenderTarget->ClearColor = FLinearColor::Black;
+	RenderTarget->InitAutoFormat(SizeX, SizeY);
+	RenderTarget->RenderTargetFormat = Format;
+	RenderTarget->bForceLinearGamma = true;
+	RenderTarget->SRGB = false;
+	// Post-process stages write their result back through a UAV
+	RenderTarget->bCanCreateUAV = true;
+	RenderTarget->UpdateResourceImmediate(true);
+
+	return RenderTarget;
+}
+
+void FQuickBakerRenderTargetPool::Release(UTextureRenderTarget2D* RenderTarget)
+{
+	using namespace QuickBakerRenderTargetPool;
+	check(IsInGameThread());
+
+	if (!RenderTarget)
+	{
+		return;
+	}
+
+	IdleTargets.Add(RenderTarget);
+
+	int64 IdleBytes = 0;
+	for (const UTextureRenderTarget2D* IdleTarget : IdleTargets)
+	{
+		IdleBytes += GetTargetBytes(IdleTarget);
+	}
+
+	// Evict oldest first. The target just released is kept even if it alone exceeds the budget,
+	// since the next bake is most likely to request the same size again.
+	while (IdleTargets.Num() > 1 && IdleBytes > MaxIdleBytes)
+	{
+		UTextureRenderTarget2D* Oldest = IdleTargets[0];
+		IdleBytes -= GetTargetBytes(Oldest);
+		IdleTargets.RemoveAt(0, 1, EAllowShrinking::No);
+		FreeTarget(Oldest);
+	}
+}
+
+void FQuickBakerRenderTargetPool::Empty()
+{
+	using namespace QuickBakerRenderTargetPool;
+
+	// Objects are already torn down if the UObject system shut down first
+	if (!UObjectInitialized())
+	{
+		IdleTargets.Empty();
+		return;
+	}
+
+	for (UTextureRenderTarget2D* IdleTarget : IdleTargets)
+	{
+		FreeTarget(IdleTarget);
+	}
+	IdleTargets.Empty();
+}
+
+void FQuickBakerRenderTargetPool::GetCounters(int32& OutNumHits, int32& OutNumMisses)
+{
+	using namespace QuickBakerRenderTargetPool;
+
+	OutNumHits = NumHits;
+	OutNumMisses = NumMisses;
+}
+
+int64 FQuickBakerRenderTargetPool::GetTargetBytes(const UTextureRenderTarget2D* RenderTarget)
+{
+	const EPixelFormat PixelFormat = GetPixelFormatFromRenderTargetFormat(RenderTarget->RenderTargetFormat);
+	return (int64)RenderTarget->SizeX * RenderTarget->SizeY * GPixelFormats[PixelFormat].BlockBytes;
+}
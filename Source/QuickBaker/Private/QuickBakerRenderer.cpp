@@ -0,0 +1,111 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerRenderer.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+#include "MaterialShared.h"
+#include "CanvasTypes.h"
+#include "CanvasItem.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+
+namespace QuickBakerRenderer
+{
+	/** A draw resolved on the game thread, safe to hand to the render thread. */
+	struct FResolvedDraw
+	{
+		const FMaterialRenderProxy* MaterialProxy = nullptr;
+		FVector2D Position;
+		FVector2D Size;
+		FVector2D UV0;
+		FVector2D UV1;
+	};
+}
+
+bool FQuickBakerRenderer::DrawMaterials(UWorld* World, UTextureRenderTarget2D* RenderTarget, TConstArrayView<FQuickBakerMaterialDraw> Draws, FQuickBakerGraphPasses AfterDraw)
+{
+	using namespace QuickBakerRenderer;
+	check(IsInGameThread());
+
+	if (!World || !RenderTarget)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("DrawMaterials failed: World or RenderTarget is null."));
+		return false;
+	}
+
+	FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!RTResource)
+	{
+		UE_LOG(LogQuickBaker, Error, TEXT("DrawMaterials failed: Could not get RenderTarget Resource from %s."), *RenderTarget->GetName());
+		return false;
+	}
+
+	const FVector2D TargetSize(RenderTarget->SizeX, RenderTarget->SizeY);
+
+	TArray<FResolvedDraw> ResolvedDraws;
+	ResolvedDraws.Reserve(Draws.Num());
+	for (const FQuickBakerMaterialDraw& Draw : Draws)
+	{
+		if (!Draw.Material)
+		{
+			UE_LOG(LogQuickBaker, Error, TEXT("DrawMaterials failed: Material is null."));
+			return false;
+		}
+
+		// Drawing with missing shaders would silently fall back to the default material
+		Draw.Material->EnsureIsComplete();
+
+		FResolvedDraw& Resolved = ResolvedDraws.AddDefaulted_GetRef();
+		Resolved.MaterialProxy = Draw.Material->GetRenderProxy();
+		Resolved.Position = Draw.Position;
+		Resolved.Size = Draw.Size.IsZero() ? TargetSize : Draw.Size;
+		Resolved.UV0 = Draw.UV0;
+		Resolved.UV1 = Draw.UV1;
+	}
+
+	// Parameter collection changes made this frame must reach the render thread before the draw
+	World->FlushDeferredParameterCollectionInstanceUpdates();
+
+	const ERHIFeatureLevel::Type FeatureLevel = World->GetFeatureLevel();
+	const FGameTime Time = World->GetTime();
+
+	ENQUEUE_RENDER_COMMAND(QuickBakerDrawMaterials)(
+		[RTResource, ResolvedDraws = MoveTemp(ResolvedDraws), FeatureLevel, Time, AfterDraw = MoveTemp(AfterDraw)](FRHICommandListImmediate& RHICmdList)
+		{
+			FRDGBuilder GraphBuilder(RHICmdList, RDG_EVENT_NAME("QuickBakerDrawMaterials"));
+			FRDGTextureRef BakeTarget = RegisterExternalTexture(GraphBuilder, RTResource->GetRenderTargetTexture(), TEXT("QuickBakerTarget"));
+
+			// The canvas pass always loads the target, so the clear is its own pass rather than a load action that only
+			// works if RDG merges an empty pass into the canvas pass
+			AddClearRenderTargetPass(GraphBuilder, BakeTarget, FLinearColor::Black);
+
+			// All draws go into one canvas batch: one pass over the target, however many cells there are
+			FCanvas* Canvas = FCanvas::Create(GraphBuilder, BakeTarget, nullptr, Time, FeatureLevel);
+			for (const FResolvedDraw& Draw : ResolvedDraws)
+			{
+				FCanvasTileItem TileItem(Draw.Position, Draw.MaterialProxy, Draw.Size, Draw.UV0, Draw.UV1);
+				Canvas->DrawItem(TileItem);
+			}
+			Canvas->Flush_RenderThread(GraphBuilder, true);
+
+			if (AfterDraw)
+			{
+				AfterDraw(GraphBuilder, BakeTarget);
+			}
+
+			GraphBuilder.Execute();
+		});
+
+	return true;
+}
+
+bool FQuickBakerRenderer::DrawMaterial(UWorld* World, UTextureRenderTarget2D* RenderTarget, UMaterialInterface* Material, FQuickBakerGraphPasses AfterDraw)
+{
+	FQuickBakerMaterialDraw Draw;
+	Draw.Material = Material;
+	return DrawMaterials(World, RenderTarget, MakeArrayView(&Draw, 1), MoveTemp(AfterDraw));
+}
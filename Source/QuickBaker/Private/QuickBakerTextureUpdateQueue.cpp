@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerTextureUpdateQueue.h"
+#include "QuickBakerExporter.h" // For LogQuickBaker
+#include "Engine/Texture.h"
+#include "TextureResource.h"
+#include "TextureCompiler.h"
+#include "Containers/Ticker.h"
+#include "Misc/App.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "FQuickBakerTextureUpdateQueue"
+
+namespace QuickBakerTextureUpdateQueue
+{
+	/** A texture drawn within this many seconds counts as visible. */
+	static constexpr double RecentlyRenderedSeconds = 1.0;
+
+	/** Deferred textures whose update is started per tick once the bake has returned control to the editor. */
+	static constexpr int32 UpdatesPerTick = 2;
+
+	/** Textures waiting for UpdateResource, oldest first. */
+	static TArray<TWeakObjectPtr<UTexture>> PendingTextures;
+
+	/** Textures whose update was started and whose platform data is still compiling. */
+	static TArray<TWeakObjectPtr<UTexture>> CompilingTextures;
+
+	/** Textures finished since the last notification. */
+	static int32 NumCompiled = 0;
+
+	/** Ticker driving both lists; valid only while either is non-empty. */
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	static bool WasRecentlyRendered(const UTexture* Texture)
+	{
+		const FTextureResource* Resource = Texture->GetResource();
+		return Resource && FApp::GetCurrentTime() - Resource->LastRenderTime < RecentlyRenderedSeconds;
+	}
+
+	static void StartUpdate(UTexture* Texture)
+	{
+		// With asynchronous texture compilation this only queues the build on the texture compiling manager
+		Texture->UpdateResource();
+		CompilingTextures.AddUnique(Texture);
+	}
+
+	static bool Tick(float DeltaTime)
+	{
+		for (int32 Count = 0; Count < UpdatesPerTick && PendingTextures.Num() > 0; ++Count)
+		{
+			if (UTexture* Texture = PendingTextures[0].Get())
+			{
+				StartUpdate(Texture);
+			}
+			PendingTextures.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+
+		NumCompiled += CompilingTextures.RemoveAll([](const TWeakObjectPtr<UTexture>& Texture)
+		{
+			return !Texture.IsValid() || !Texture->IsCompiling();
+		});
+
+		if (PendingTextures.Num() > 0 || CompilingTextures.Num() > 0)
+		{
+			return true;
+		}
+
+		// Everything baked in this batch now has GPU-ready data
+		if (NumCompiled > 0)
+		{
+			UE_LOG(LogQuickBaker, Log, TEXT("%d baked texture(s) finished compiling."), NumCompiled);
+
+			FNotificationInfo Info(FText::Format(LOCTEXT("TexturesCompiled", "QuickBaker: {0} baked {0}|plural(one=texture,other=textures) ready"), NumCompiled));
+			Info.ExpireDuration = 3.0f;
+			FSlateNotificationManager::Get().AddNotification(Info);
+			NumCompiled = 0;
+		}
+
+		TickerHandle.Reset();
+		return false;
+	}
+}
+
+void FQuickBakerTextureUpdateQueue::RequestUpdate(UTexture* Texture, bool bAllowDefer)
+{
+	using namespace QuickBakerTextureUpdateQueue;
+	check(IsInGameThread());
+
+	if (!Texture)
+	{
+		return;
+	}
+
+	if (!bAllowDefer || WasRecentlyRendered(Texture))
+	{
+		PendingTextures.Remove(Texture);
+		StartUpdate(Texture);
+	}
+	else
+	{
+		PendingTextures.AddUnique(Texture);
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&QuickBakerTextureUpdateQueue::Tick));
+	}
+}
+
+void FQuickBakerTextureUpdateQueue::PrepareSourceChange(UTexture* Texture)
+{
+	using namespace QuickBakerTextureUpdateQueue;
+	check(IsInGameThread());
+
+	if (!Texture)
+	{
+		return;
+	}
+
+	// The saved texture requests its update again, so the deferred one would only rebuild from the old source
+	PendingTextures.Remove(Texture);
+
+	// A quick rebake can arrive while the previous build of this texture still reads its source
+	if (Texture->IsCompiling())
+	{
+		FTextureCompilingManager::Get().FinishCompilation({ Texture });
+	}
+}
+
+int32 FQuickBakerTextureUpdateQueue::GetNumPending()
+{
+	using namespace QuickBakerTextureUpdateQueue;
+	return PendingTextures.Num() + CompilingTextures.Num();
+}
+
+void FQuickBakerTextureUpdateQueue::Empty()
+{
+	using namespace QuickBakerTextureUpdateQueue;
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	PendingTextures.Empty();
+	CompilingTextures.Empty();
+	NumCompiled = 0;
+}
+
+#undef LOCTEXT_NAMESPACE
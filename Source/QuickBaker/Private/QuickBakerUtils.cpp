@@ -19,3 +19,22 @@ FString FQuickBakerUtils::GetTextureNameFromMaterial(const FString& MaterialName
 	}
 	return Name;
 }
+
+void FQuickBakerUtils::GetCubeFaceBasis(int32 FaceIndex, FVector& OutForward, FVector& OutRight, FVector& OutDown)
+{
+	// Matches the hardware cubemap convention used when a TextureCube is sampled with a world direction
+	static const FVector Bases[6][3] =
+	{
+		{ FVector( 1, 0, 0), FVector( 0, 0, -1), FVector(0, -1,  0) }, // +X
+		{ FVector(-1, 0, 0), FVector( 0, 0,  1), FVector(0, -1,  0) }, // -X
+		{ FVector( 0, 1, 0), FVector( 1, 0,  0), FVector(0,  0,  1) }, // +Y
+		{ FVector( 0,-1, 0), FVector( 1, 0,  0), FVector(0,  0, -1) }, // -Y
+		{ FVector( 0, 0, 1), FVector( 1, 0,  0), FVector(0, -1,  0) }, // +Z
+		{ FVector( 0, 0,-1), FVector(-1, 0,  0), FVector(0, -1,  0) }  // -Z
+	};
+
+	check(FaceIndex >= 0 && FaceIndex < 6);
+	OutForward = Bases[FaceIndex][0];
+	OutRight = Bases[FaceIndex][1];
+	OutDown = Bases[FaceIndex][2];
+}
@@ -2,13 +2,17 @@
 
 #include "SQuickBakerWidget.h"
 #include "QuickBakerEditorSettings.h"
+#include "QuickBakerBakeHistory.h"
 #include "QuickBakerCore.h"
 #include "QuickBakerUtils.h"
 #include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SNumericEntryBox.h"
 #include "PropertyCustomizationHelpers.h"
 #include "AssetThumbnail.h"
 #include "Materials/MaterialInterface.h"
@@ -19,11 +23,22 @@
 #include "Misc/PackageName.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/FileManager.h"
+#include "QuickBakerRenderTargetPool.h"
+#include "QuickBakerRenderer.h"
+#include "Widgets/Images/SImage.h"
+#include "Materials/Material.h"
+#include "Editor.h"
 
 #define LOCTEXT_NAMESPACE "SQuickBakerWidget"
 
 static constexpr int32 LargeTextureWarningThreshold = 8192;
 
+/** Resolutions of the progressive preview, drawn one per frame from coarse to fine. */
+static constexpr int32 PreviewResolutions[] = { 128, 256, 512 };
+
+/** On-screen size of the preview panel, independent of the current preview resolution. */
+static constexpr float PreviewDisplaySize = 256.0f;
+
 void SQuickBakerWidget::Construct(const FArguments& InArgs)
 {
 	bShowMaterialWarning = false;
@@ -31,6 +46,11 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 	MaterialThumbnail = MakeShareable(new FAssetThumbnail(FAssetData(), 64, 64, ThumbnailPool));
 	InitializeOptions();
 
+	PreviewBrush.DrawAs = ESlateBrushDrawType::Image;
+	PreviewBrush.ImageSize = FVector2D(PreviewDisplaySize);
+	NextPreviewStep = UE_ARRAY_COUNT(PreviewResolutions);
+	UMaterial::OnMaterialCompilationFinished().AddSP(this, &SQuickBakerWidget::OnMaterialCompilationFinished);
+
 	ChildSlot
 	[
 		SNew(SVerticalBox)
@@ -87,7 +107,24 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			.Visibility(EVisibility::Collapsed)
 		]
 
-		// 4. Output Type
+		// 4. Live Preview
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.HAlign(HAlign_Center)
+		.Padding(5)
+		[
+			SNew(SBox)
+			.WidthOverride_Lambda([this]() { return FOptionalSize(PreviewBrush.ImageSize.X); })
+			.HeightOverride_Lambda([this]() { return FOptionalSize(PreviewBrush.ImageSize.Y); })
+			.Visibility_Lambda([this]() { return PreviewBrush.GetResourceObject() ? EVisibility::Visible : EVisibility::Collapsed; })
+			.ToolTipText(LOCTEXT("Tooltip_Preview", "Live preview of the material output. Starts at low resolution and refines over the next frames."))
+			[
+				SNew(SImage)
+				.Image(&PreviewBrush)
+			]
+		]
+
+		// 5. Output Type
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -104,7 +141,7 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			.FillWidth(1.0f)
 			[
 				SNew(SComboBox<TSharedPtr<EQuickBakerOutputType>>)
-				.ToolTipText(LOCTEXT("Tooltip_OutputType", "Select the output format: Asset, PNG, or EXR."))
+				.ToolTipText(LOCTEXT("Tooltip_OutputType", "Select the output format: Asset, PNG, EXR, or a fast format for quick iteration (QOI, uncompressed TGA/DDS, NumPy or raw pixel dumps)."))
 				.OptionsSource(&OutputTypeOptions)
 				.InitiallySelectedItem(SelectedOutputType)
 				.OnGenerateWidget_Raw(this, &SQuickBakerWidget::GenerateOutputTypeWidget)
@@ -115,7 +152,208 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 5. Resolution
+		// 6. Bake Mode
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_BakeMode", "Bake Mode"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SComboBox<TSharedPtr<EQuickBakerBakeMode>>)
+				.ToolTipText(LOCTEXT("Tooltip_BakeMode", "Single bakes the material once. Flipbook bakes several time steps into a grid of frames in one texture. Cubemap bakes six faces into a Texture Cube asset, or an equirectangular PNG/EXR. UDIM bakes a grid of tiles into a virtual texture asset, or one PNG/EXR per tile."))
+				.OptionsSource(&BakeModeOptions)
+				.InitiallySelectedItem(SelectedBakeMode)
+				.OnGenerateWidget_Raw(this, &SQuickBakerWidget::GenerateBakeModeWidget)
+				.OnSelectionChanged_Raw(this, &SQuickBakerWidget::OnBakeModeChanged)
+				[
+					SNew(STextBlock).Text_Raw(this, &SQuickBakerWidget::GetSelectedBakeModeText)
+				]
+			]
+		]
+
+		// 7. Flipbook Settings (Only visible for Flipbook mode)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5, 0, 5, 0)
+		[
+			SNew(SVerticalBox)
+			.Visibility_Raw(this, &SQuickBakerWidget::GetFlipbookVisibility)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 5)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0, 0, 10, 0)
+				[
+					SNew(STextBlock).Text(LOCTEXT("Label_FrameCount", "Frame Count"))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SNew(SNumericEntryBox<int32>)
+					.ToolTipText(LOCTEXT("Tooltip_FrameCount", "Number of frames to bake. Each frame is Width x Height pixels."))
+					.MinValue(1)
+					.Value_Lambda([this] { return TOptional<int32>(Settings.FlipbookFrameCount); })
+					.OnValueChanged_Lambda([this](int32 NewValue) { Settings.FlipbookFrameCount = NewValue; RequestPreviewUpdate(); })
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 5)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0, 0, 10, 0)
+				[
+					SNew(STextBlock).Text(LOCTEXT("Label_Grid", "Grid (Columns x Rows)"))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SNew(SNumericEntryBox<int32>)
+					.ToolTipText(LOCTEXT("Tooltip_Columns", "Number of frame columns in the flipbook."))
+					.MinValue(1)
+					.Value_Lambda([this] { return TOptional<int32>(Settings.FlipbookColumns); })
+					.OnValueChanged_Lambda([this](int32 NewValue) { Settings.FlipbookColumns = NewValue; RequestPreviewUpdate(); })
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				.Padding(5, 0, 0, 0)
+				[
+					SNew(SNumericEntryBox<int32>)
+					.ToolTipText(LOCTEXT("Tooltip_Rows", "Number of frame rows in the flipbook."))
+					.MinValue(1)
+					.Value_Lambda([this] { return TOptional<int32>(Settings.FlipbookRows); })
+					.OnValueChanged_Lambda([this](int32 NewValue) { Settings.FlipbookRows = NewValue; RequestPreviewUpdate(); })
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 5)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0, 0, 10, 0)
+				[
+					SNew(STextBlock).Text(LOCTEXT("Label_TimeParameter", "Time Parameter"))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SNew(SEditableTextBox)
+					.ToolTipText(LOCTEXT("Tooltip_TimeParameter", "Name of the scalar material parameter that receives each frame's time in seconds. Use it instead of the Time node."))
+					.Text_Lambda([this] { return FText::FromName(Settings.TimeParameterName); })
+					.OnTextChanged_Lambda([this](const FText& NewText) { Settings.TimeParameterName = FName(*NewText.ToString()); RequestPreviewUpdate(); })
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 5)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0, 0, 10, 0)
+				[
+					SNew(STextBlock).Text(LOCTEXT("Label_Duration", "Duration (s)"))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SNew(SNumericEntryBox<float>)
+					.ToolTipText(LOCTEXT("Tooltip_Duration", "Time span covered by the flipbook. Frames are evenly spaced so the last frame loops back to the first."))
+					.MinValue(0.0f)
+					.Value_Lambda([this] { return TOptional<float>(Settings.FlipbookDuration); })
+					.OnValueChanged_Lambda([this](float NewValue) { Settings.FlipbookDuration = NewValue; RequestPreviewUpdate(); })
+				]
+			]
+		]
+
+		// 8. Cubemap Settings (Only visible for Cubemap mode)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			.Visibility_Lambda([this]() {
+				return (SelectedBakeMode.IsValid() && *SelectedBakeMode == EQuickBakerBakeMode::Cubemap)
+					? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_CubeFacePrefix", "Face Parameter Prefix"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SEditableTextBox)
+				.ToolTipText(LOCTEXT("Tooltip_CubeFacePrefix", "Prefix of the vector parameters <Prefix>Forward, <Prefix>Right and <Prefix>Down. Sample direction = Forward + (2U - 1) * Right + (2V - 1) * Down."))
+				.Text_Lambda([this] { return FText::FromName(Settings.CubeFaceParameterPrefix); })
+				.OnTextChanged_Lambda([this](const FText& NewText) { Settings.CubeFaceParameterPrefix = FName(*NewText.ToString()); RequestPreviewUpdate(); })
+			]
+		]
+
+		// 9. UDIM Settings (Only visible for UDIM mode)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			.Visibility_Lambda([this]() {
+				return (SelectedBakeMode.IsValid() && *SelectedBakeMode == EQuickBakerBakeMode::UDIM)
+					? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_UDIMTiles", "Tiles (U x V)"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SNumericEntryBox<int32>)
+				.ToolTipText(LOCTEXT("Tooltip_UDIMTilesU", "Number of UDIM tile columns (at most 10). Each tile is Width x Height pixels."))
+				.MinValue(1)
+				.MaxValue(10)
+				.Value_Lambda([this] { return TOptional<int32>(Settings.UDIMTilesU); })
+				.OnValueChanged_Lambda([this](int32 NewValue) { Settings.UDIMTilesU = NewValue; RequestPreviewUpdate(); })
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(5, 0, 0, 0)
+			[
+				SNew(SNumericEntryBox<int32>)
+				.ToolTipText(LOCTEXT("Tooltip_UDIMTilesV", "Number of UDIM tile rows."))
+				.MinValue(1)
+				.MaxValue(99)
+				.Value_Lambda([this] { return TOptional<int32>(Settings.UDIMTilesV); })
+				.OnValueChanged_Lambda([this](int32 NewValue) { Settings.UDIMTilesV = NewValue; RequestPreviewUpdate(); })
+			]
+		]
+
+		// 10. Resolution
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -130,9 +368,37 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 			+ SHorizontalBox::Slot()
 			.FillWidth(1.0f)
+			[
+				SNew(SNumericEntryBox<int32>)
+				.ToolTipText(LOCTEXT("Tooltip_Width", "Width of the output texture in pixels. Any size is allowed; strips and LUTs do not need to be square."))
+				.MinValue(1)
+				.Value_Lambda([this] { return TOptional<int32>(Settings.Width); })
+				.OnValueChanged_Lambda([this](int32 NewValue) { Settings.Width = NewValue; RequestPreviewUpdate(); })
+				.OnValueCommitted_Raw(this, &SQuickBakerWidget::OnResolutionCommitted)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_ResolutionSeparator", "x"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SNumericEntryBox<int32>)
+				.ToolTipText(LOCTEXT("Tooltip_Height", "Height of the output texture in pixels. Cubemap faces must be square."))
+				.MinValue(1)
+				.Value_Lambda([this] { return TOptional<int32>(Settings.Height); })
+				.OnValueChanged_Lambda([this](int32 NewValue) { Settings.Height = NewValue; RequestPreviewUpdate(); })
+				.OnValueCommitted_Raw(this, &SQuickBakerWidget::OnResolutionCommitted)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5, 0, 0, 0)
 			[
 				SNew(SComboBox<TSharedPtr<int32>>)
-				.ToolTipText(LOCTEXT("Tooltip_Resolution", "Set the width and height of the output texture. Higher values provide more detail but use more memory."))
+				.ToolTipText(LOCTEXT("Tooltip_Resolution", "Set the width and height of the output texture to a square preset. Higher values provide more detail but use more memory."))
 				.OptionsSource(&ResolutionOptions)
 				.InitiallySelectedItem(SelectedResolution)
 				.OnGenerateWidget_Raw(this, &SQuickBakerWidget::GenerateResolutionWidget)
@@ -143,7 +409,35 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 6. Bit Depth
+		// 11. Resolution Variants (Not available for UDIM mode)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			.Visibility_Lambda([this]() {
+				return (SelectedBakeMode.IsValid() && *SelectedBakeMode == EQuickBakerBakeMode::UDIM)
+					? EVisibility::Collapsed : EVisibility::Visible;
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_ResolutionVariants", "Resolution Variants"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SEditableTextBox)
+				.ToolTipText(LOCTEXT("Tooltip_ResolutionVariants", "Comma-separated widths of smaller copies to save as <Output Name>_<Width>, e.g. 1024, 256. The material is rendered once and the copies are downsampled on the GPU. Heights keep the aspect ratio."))
+				.HintText(LOCTEXT("Hint_ResolutionVariants", "None"))
+				.Text_Raw(this, &SQuickBakerWidget::GetResolutionVariantsText)
+				.OnTextCommitted_Raw(this, &SQuickBakerWidget::OnResolutionVariantsCommitted)
+			]
+		]
+
+		// 12. Bit Depth
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -160,8 +454,8 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			.FillWidth(1.0f)
 			[
 				SNew(SComboBox<TSharedPtr<EQuickBakerBitDepth>>)
-				.IsEnabled_Lambda([this]() { return SelectedOutputType.IsValid() && *SelectedOutputType == EQuickBakerOutputType::Asset; })
-				.ToolTipText(LOCTEXT("Tooltip_BitDepth", "Choose between 8-bit and 16-bit. 16-bit is highly recommended for Noise and SDF to avoid banding."))
+				.IsEnabled_Lambda([this]() { return SelectedOutputType.IsValid() && FQuickBakerSettings::SupportsBitDepth(*SelectedOutputType); })
+				.ToolTipText(LOCTEXT("Tooltip_BitDepth", "Choose between 8-bit and 16-bit. 16-bit is highly recommended for Noise and SDF to avoid banding. PNG, QOI and TGA are always 8-bit and EXR is always 16-bit."))
 				.OptionsSource(&BitDepthOptions)
 				.InitiallySelectedItem(SelectedBitDepth)
 				.OnGenerateWidget_Raw(this, &SQuickBakerWidget::GenerateBitDepthWidget)
@@ -172,7 +466,7 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 7. Compression (Only visible for Asset output)
+		// 13. Compression (Only visible for Asset output)
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -204,7 +498,160 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 8. Output Name
+		// 14. Texture Usage (Only visible for Asset output)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			.Visibility_Lambda([this]() {
+				return (SelectedOutputType.IsValid() && *SelectedOutputType == EQuickBakerOutputType::Asset)
+					? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_Usage", "Texture Usage"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SComboBox<TSharedPtr<EQuickBakerTextureUsage>>)
+				.ToolTipText(LOCTEXT("Tooltip_Usage", "What the texture is used for in game. Picks the output rule (Project Settings > Plugins > QuickBaker) that sets its texture group, mips, size limit and streaming. Auto derives it from the bake mode and compression."))
+				.OptionsSource(&UsageOptions)
+				.InitiallySelectedItem(SelectedUsage)
+				.OnGenerateWidget_Raw(this, &SQuickBakerWidget::GenerateUsageWidget)
+				.OnSelectionChanged_Raw(this, &SQuickBakerWidget::OnUsageChanged)
+				[
+					SNew(STextBlock).Text_Raw(this, &SQuickBakerWidget::GetSelectedUsageText)
+				]
+			]
+		]
+
+		// 15. Compress Source (Only visible for Asset output)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			.Visibility_Lambda([this]() {
+				return (SelectedOutputType.IsValid() && *SelectedOutputType == EQuickBakerOutputType::Asset)
+					? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_CompressSource", "Compress Source"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SCheckBox)
+				.ToolTipText(LOCTEXT("Tooltip_CompressSource", "Store the texture source as lossless PNG inside the asset. Makes 8-bit and grayscale packages much smaller; 16-bit color and cubemap sources are always stored raw."))
+				.IsChecked_Lambda([this] { return Settings.bCompressSource ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Raw(this, &SQuickBakerWidget::OnCompressSourceChanged)
+			]
+		]
+
+		// 16. Post Process
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Top)
+			.Padding(0, 3, 10, 0)
+			[
+				SNew(STextBlock).Text(LOCTEXT("Label_PostProcess", "Post Process"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					MakePostProcessRow(EQuickBakerPostProcessType::SignedDistance, LOCTEXT("Label_SignedDistance", "SDF"),
+						LOCTEXT("Tooltip_SignedDistance", "Turn the baked mask (red channel) into a signed distance field on the GPU, positive inside. Stored signed at 16-bit/EXR, as 0.5 + 0.5 * distance at 8-bit."),
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							MakePostProcessValueBox(EQuickBakerPostProcessType::SignedDistance, &FQuickBakerPostProcessStage::Radius, 1.0f, 4096.0f,
+								LOCTEXT("Tooltip_SignedDistanceSpread", "Spread: the distance in pixels that maps to 1."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.Padding(5, 0, 0, 0)
+						[
+							MakePostProcessValueBox(EQuickBakerPostProcessType::SignedDistance, &FQuickBakerPostProcessStage::Threshold, 0.0f, 1.0f,
+								LOCTEXT("Tooltip_SignedDistanceThreshold", "Mask value above which a pixel is inside."))
+						])
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 2, 0, 0)
+				[
+					MakePostProcessRow(EQuickBakerPostProcessType::Dilate, LOCTEXT("Label_Dilate", "Dilate"),
+						LOCTEXT("Tooltip_Dilate", "Grow colors into empty (zero alpha) pixels on the GPU, e.g. padding around UV islands. Alpha is kept."),
+						MakePostProcessValueBox(EQuickBakerPostProcessType::Dilate, &FQuickBakerPostProcessStage::Radius, 1.0f, (float)FQuickBakerPostProcess::MaxRadius,
+							LOCTEXT("Tooltip_DilateRadius", "Number of pixels to grow.")))
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 2, 0, 0)
+				[
+					MakePostProcessRow(EQuickBakerPostProcessType::Blur, LOCTEXT("Label_Blur", "Blur"),
+						LOCTEXT("Tooltip_Blur", "Gaussian blur on the GPU. Flipbook frames and cube faces are blurred separately."),
+						MakePostProcessValueBox(EQuickBakerPostProcessType::Blur, &FQuickBakerPostProcessStage::Radius, 0.5f, (float)FQuickBakerPostProcess::MaxRadius,
+							LOCTEXT("Tooltip_BlurRadius", "Blur radius in pixels.")))
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 2, 0, 0)
+				[
+					MakePostProcessRow(EQuickBakerPostProcessType::Levels, LOCTEXT("Label_Levels", "Levels"),
+						LOCTEXT("Tooltip_Levels", "Remap RGB from the input black/white points to 0-1 with a gamma curve. Alpha is kept."),
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							MakePostProcessValueBox(EQuickBakerPostProcessType::Levels, &FQuickBakerPostProcessStage::InBlack, -65504.0f, 65504.0f,
+								LOCTEXT("Tooltip_LevelsInBlack", "Input black point."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.Padding(5, 0, 0, 0)
+						[
+							MakePostProcessValueBox(EQuickBakerPostProcessType::Levels, &FQuickBakerPostProcessStage::InWhite, -65504.0f, 65504.0f,
+								LOCTEXT("Tooltip_LevelsInWhite", "Input white point."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.Padding(5, 0, 0, 0)
+						[
+							MakePostProcessValueBox(EQuickBakerPostProcessType::Levels, &FQuickBakerPostProcessStage::Gamma, 0.01f, 10.0f,
+								LOCTEXT("Tooltip_LevelsGamma", "Gamma. Above 1 brightens midtones."))
+						])
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 2, 0, 0)
+				[
+					MakePostProcessRow(EQuickBakerPostProcessType::Normalize, LOCTEXT("Label_Normalize", "Normalize"),
+						LOCTEXT("Tooltip_Normalize", "Remap the RGB value range of the whole image to 0-1 on the GPU. Runs after the stages above."),
+						SNullWidget::NullWidget)
+				]
+			]
+		]
+
+		// 17. Output Name
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -227,7 +674,7 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 9. Output Path
+		// 18. Output Path
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -264,7 +711,7 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 10. Bake Button
+		// 19. Bake Button
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.Padding(5)
@@ -276,6 +723,24 @@ void SQuickBakerWidget::Construct(const FArguments& InArgs)
 			.Text(LOCTEXT("BakeTexture", "Bake Texture"))
 			.OnClicked_Raw(this, &SQuickBakerWidget::OnBakeClicked)
 		]
+
+		// 20. Bake History
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SExpandableArea)
+			.InitiallyCollapsed(true)
+			.AreaTitle(LOCTEXT("Label_BakeHistory", "Bake History"))
+			.ToolTipText(LOCTEXT("Tooltip_BakeHistory", "Throughput of recent bakes of the selected material and the slowest materials, from Saved/QuickBaker/BakeHistory.jsonl."))
+			.OnAreaExpansionChanged_Raw(this, &SQuickBakerWidget::OnBakeHistoryExpansionChanged)
+			.BodyContent()
+			[
+				SNew(STextBlock)
+				.AutoWrapText(true)
+				.Text_Lambda([this] { return BakeHistoryText; })
+			]
+		]
 	];
 }
 
@@ -285,6 +750,154 @@ SQuickBakerWidget::~SQuickBakerWidget()
 	{
 		ThumbnailPool.Reset();
 	}
+
+	UMaterial::OnMaterialCompilationFinished().RemoveAll(this);
+
+	// Hand the preview targets back so later bakes and previews can reuse them
+	for (UTextureRenderTarget2D* PreviewTarget : PreviewTargets)
+	{
+		FQuickBakerRenderTargetPool::Release(PreviewTarget);
+	}
+	PreviewTargets.Empty();
+}
+
+void SQuickBakerWidget::RequestPreviewUpdate()
+{
+	NextPreviewStep = 0;
+
+	if (!Settings.SelectedMaterial.IsValid())
+	{
+		PreviewBrush.SetResourceObject(nullptr);
+		return;
+	}
+
+	if (!PreviewTimerHandle.IsValid())
+	{
+		PreviewTimerHandle = RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SQuickBakerWidget::UpdatePreview));
+	}
+}
+
+EActiveTimerReturnType SQuickBakerWidget::UpdatePreview(double InCurrentTime, float InDeltaTime)
+{
+	UMaterialInterface* Material = Settings.SelectedMaterial.Get();
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!Material || !World || NextPreviewStep >= UE_ARRAY_COUNT(PreviewResolutions))
+	{
+		PreviewTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Drawing before shaders are ready would show the default material; OnMaterialCompilationFinished restarts us
+	if (Material->IsCompiling())
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	// The preview is the bake scaled down to the step's resolution: same layout, format and post-process chain.
+	// UDIM bakes show their first tile; variants are not drawn.
+	FQuickBakerSettings PreviewSettings = Settings;
+	PreviewSettings.ResolutionVariants.Reset();
+	if (PreviewSettings.BakeMode == EQuickBakerBakeMode::UDIM)
+	{
+		PreviewSettings.BakeMode = EQuickBakerBakeMode::Single;
+	}
+
+	const FIntPoint OutputSize = PreviewSettings.GetOutputSize();
+	if (OutputSize.X <= 0 || OutputSize.Y <= 0
+		|| (PreviewSettings.BakeMode == EQuickBakerBakeMode::Flipbook && (int64)PreviewSettings.FlipbookColumns * PreviewSettings.FlipbookRows < PreviewSettings.FlipbookFrameCount))
+	{
+		PreviewBrush.SetResourceObject(nullptr);
+		PreviewTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	const float Scale = FMath::Min(1.0f, (float)PreviewResolutions[NextPreviewStep] / FMath::Max(OutputSize.X, OutputSize.Y));
+	PreviewSettings.Width = FMath::Max(1, FMath::RoundToInt(PreviewSettings.Width * Scale));
+	PreviewSettings.Height = FMath::Max(1, FMath::RoundToInt(PreviewSettings.Height * Scale));
+
+	// Pixel radii shrink with the image, so blurs and dilation cover the same share of it as in the bake
+	for (FQuickBakerPostProcessStage& Stage : PreviewSettings.PostProcessStages)
+	{
+		Stage.Radius = FMath::Max(Stage.Radius * Scale, 1.0f);
+	}
+
+	// Slate would draw one- and two-channel targets in red and green, so those use the four-channel format of the
+	// same precision
+	ETextureRenderTargetFormat Format = FQuickBakerCore::GetRenderTargetFormat(PreviewSettings);
+	if (Format == RTF_R8 || Format == RTF_RG8)
+	{
+		Format = RTF_RGBA8;
+	}
+	else if (Format == RTF_R16f || Format == RTF_RG16f || Format == RTF_R32f || Format == RTF_RG32f)
+	{
+		Format = RTF_RGBA16f;
+	}
+
+	const FIntPoint PreviewSize = PreviewSettings.GetOutputSize();
+	UTextureRenderTarget2D* PreviewTarget = PreviewTargets.IsValidIndex(NextPreviewStep) ? PreviewTargets[NextPreviewStep] : nullptr;
+	if (!PreviewTarget || PreviewTarget->SizeX != PreviewSize.X || PreviewTarget->SizeY != PreviewSize.Y || PreviewTarget->RenderTargetFormat != Format)
+	{
+		// A released target may be handed to a bake, so the brush lets go of it
+		if (PreviewTarget)
+		{
+			if (PreviewBrush.GetResourceObject() == PreviewTarget)
+			{
+				PreviewBrush.SetResourceObject(nullptr);
+			}
+			FQuickBakerRenderTargetPool::Release(PreviewTarget);
+			PreviewTargets[NextPreviewStep] = nullptr;
+		}
+
+		PreviewTarget = FQuickBakerRenderTargetPool::Acquire(PreviewSize.X, PreviewSize.Y, Format);
+		if (!PreviewTarget)
+		{
+			PreviewTimerHandle.Reset();
+			return EActiveTimerReturnType::Stop;
+		}
+
+		if (PreviewTargets.IsValidIndex(NextPreviewStep))
+		{
+			PreviewTargets[NextPreviewStep] = PreviewTarget;
+		}
+		else
+		{
+			PreviewTargets.Add(PreviewTarget);
+		}
+	}
+
+	// Only enqueues the draw; there is no flush, so the GPU finishes it while Slate keeps running.
+	// Rendering commands are ordered, so Slate samples the target only after the draw completes.
+	FQuickBakerGraphPasses AfterDraw = FQuickBakerCore::MakeBakePasses(PreviewSettings, {});
+	const bool bDrawn = PreviewSettings.BakeMode == EQuickBakerBakeMode::Single
+		? FQuickBakerRenderer::DrawMaterial(World, PreviewTarget, Material, MoveTemp(AfterDraw))
+		: FQuickBakerCore::DrawMaterialCells(World, PreviewTarget, PreviewSettings, MoveTemp(AfterDraw));
+	if (!bDrawn)
+	{
+		PreviewTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Fit the output's aspect ratio into the preview panel
+	const float DisplayScale = PreviewDisplaySize / FMath::Max(PreviewSize.X, PreviewSize.Y);
+	PreviewBrush.ImageSize = FVector2D(PreviewSize.X * DisplayScale, PreviewSize.Y * DisplayScale);
+	PreviewBrush.SetResourceObject(PreviewTarget);
+
+	++NextPreviewStep;
+	if (NextPreviewStep >= UE_ARRAY_COUNT(PreviewResolutions))
+	{
+		PreviewTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+void SQuickBakerWidget::OnMaterialCompilationFinished(UMaterialInterface* Material)
+{
+	UMaterialInterface* SelectedMaterial = Settings.SelectedMaterial.Get();
+	if (SelectedMaterial && Material && (SelectedMaterial == Material || SelectedMaterial->GetMaterial() == Material->GetMaterial()))
+	{
+		RequestPreviewUpdate();
+	}
 }
 
 void SQuickBakerWidget::InitializeOptions()
@@ -293,12 +906,28 @@ void SQuickBakerWidget::InitializeOptions()
 	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::Asset));
 	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::PNG));
 	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::EXR));
+	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::QOI));
+	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::TGA));
+	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::DDS));
+	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::NPY));
+	OutputTypeOptions.Add(MakeShared<EQuickBakerOutputType>(EQuickBakerOutputType::RAW));
 	if (OutputTypeOptions.Num() > 0)
 	{
 		SelectedOutputType = OutputTypeOptions[0]; // Asset
 		Settings.OutputType = *SelectedOutputType;
 	}
 
+	// Bake Mode
+	BakeModeOptions.Add(MakeShared<EQuickBakerBakeMode>(EQuickBakerBakeMode::Single));
+	BakeModeOptions.Add(MakeShared<EQuickBakerBakeMode>(EQuickBakerBakeMode::Flipbook));
+	BakeModeOptions.Add(MakeShared<EQuickBakerBakeMode>(EQuickBakerBakeMode::Cubemap));
+	BakeModeOptions.Add(MakeShared<EQuickBakerBakeMode>(EQuickBakerBakeMode::UDIM));
+	if (BakeModeOptions.Num() > 0)
+	{
+		SelectedBakeMode = BakeModeOptions[0]; // Single
+		Settings.BakeMode = *SelectedBakeMode;
+	}
+
 	// Resolution
 	TArray<int32> Resolutions = { 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
 	for (int32 Res : Resolutions)
@@ -308,12 +937,12 @@ void SQuickBakerWidget::InitializeOptions()
 	if (ResolutionOptions.Num() > 4)
 	{
 		SelectedResolution = ResolutionOptions[4]; // 1024
-		Settings.Resolution = *SelectedResolution;
+		Settings.Width = Settings.Height = *SelectedResolution;
 	}
 	else if (ResolutionOptions.Num() > 0)
 	{
 		SelectedResolution = ResolutionOptions[0];
-		Settings.Resolution = *SelectedResolution;
+		Settings.Width = Settings.Height = *SelectedResolution;
 	}
 
 	// Bit Depth
@@ -330,6 +959,9 @@ void SQuickBakerWidget::InitializeOptions()
 	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_Normalmap));
 	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_Grayscale));
 	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_HDR));
+	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_Alpha));
+	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_HalfFloat));
+	CompressionOptions.Add(MakeShared<TextureCompressionSettings>(TC_SingleFloat));
 
 	if (CompressionOptions.Num() > 0)
 	{
@@ -337,6 +969,15 @@ void SQuickBakerWidget::InitializeOptions()
 		Settings.Compression = *SelectedCompression;
 	}
 
+	// Texture Usage
+	for (const EQuickBakerTextureUsage Usage : { EQuickBakerTextureUsage::Auto, EQuickBakerTextureUsage::Color, EQuickBakerTextureUsage::Normal,
+		EQuickBakerTextureUsage::Mask, EQuickBakerTextureUsage::Data, EQuickBakerTextureUsage::UI, EQuickBakerTextureUsage::Effects })
+	{
+		UsageOptions.Add(MakeShared<EQuickBakerTextureUsage>(Usage));
+	}
+	SelectedUsage = UsageOptions[0]; // Auto
+	Settings.Usage = *SelectedUsage;
+
 	Settings.OutputPath = TEXT("/Game/Textures");
 
 	// Load saved settings
@@ -352,10 +993,10 @@ void SQuickBakerWidget::LoadSavedSettings()
 	}
 
 	// Restore Resolution
-	if (const auto* Found = ResolutionOptions.FindByPredicate([&](const TSharedPtr<int32>& Option) { return *Option == EditorSettings->LastUsedResolution; }))
+	if (EditorSettings->LastUsedWidth > 0 && EditorSettings->LastUsedHeight > 0)
 	{
-		SelectedResolution = *Found;
-		Settings.Resolution = *SelectedResolution;
+		Settings.Width = EditorSettings->LastUsedWidth;
+		Settings.Height = EditorSettings->LastUsedHeight;
 	}
 
 	// Restore Output Type
@@ -366,6 +1007,14 @@ void SQuickBakerWidget::LoadSavedSettings()
 		Settings.OutputType = *SelectedOutputType;
 	}
 
+	// Restore Bake Mode
+	const EQuickBakerBakeMode SavedBakeMode = static_cast<EQuickBakerBakeMode>(EditorSettings->LastUsedBakeMode);
+	if (const auto* Found = BakeModeOptions.FindByPredicate([&](const TSharedPtr<EQuickBakerBakeMode>& Option) { return *Option == SavedBakeMode; }))
+	{
+		SelectedBakeMode = *Found;
+		Settings.BakeMode = *SelectedBakeMode;
+	}
+
 	// Restore Bit Depth
 	const EQuickBakerBitDepth SavedBitDepth = static_cast<EQuickBakerBitDepth>(EditorSettings->LastUsedBitDepth);
 	if (const auto* Found = BitDepthOptions.FindByPredicate([&](const TSharedPtr<EQuickBakerBitDepth>& Option) { return *Option == SavedBitDepth; }))
@@ -382,6 +1031,17 @@ void SQuickBakerWidget::LoadSavedSettings()
 		Settings.Compression = *SelectedCompression;
 	}
 
+	// Restore Texture Usage
+	const EQuickBakerTextureUsage SavedUsage = static_cast<EQuickBakerTextureUsage>(EditorSettings->LastUsedUsage);
+	if (const auto* Found = UsageOptions.FindByPredicate([&](const TSharedPtr<EQuickBakerTextureUsage>& Option) { return *Option == SavedUsage; }))
+	{
+		SelectedUsage = *Found;
+		Settings.Usage = *SelectedUsage;
+	}
+
+	// Restore Compress Source
+	Settings.bCompressSource = EditorSettings->bLastUsedCompressSource;
+
 	// Restore Output Path
 	if (!EditorSettings->LastUsedOutputPath.IsEmpty())
 	{
@@ -415,13 +1075,14 @@ void SQuickBakerWidget::OnOutputTypeChanged(TSharedPtr<EQuickBakerOutputType> Ne
 		}
 
 		// BitDepthOptions[0] = Bit8, BitDepthOptions[1] = Bit16 (see InitializeOptions)
-		if (Settings.OutputType == EQuickBakerOutputType::PNG && BitDepthOptions.Num() > 0)
-		{
-			SelectedBitDepth = BitDepthOptions[0]; // Bit8
-		}
-		else if (Settings.OutputType == EQuickBakerOutputType::EXR && BitDepthOptions.Num() > 1)
+		// Formats with a fixed precision lock the bit depth; the others keep the current choice
+		if (!FQuickBakerSettings::SupportsBitDepth(Settings.OutputType))
 		{
-			SelectedBitDepth = BitDepthOptions[1]; // Bit16
+			const bool bIsFloat = Settings.OutputType == EQuickBakerOutputType::EXR;
+			if (BitDepthOptions.Num() > 1)
+			{
+				SelectedBitDepth = BitDepthOptions[bIsFloat ? 1 : 0];
+			}
 		}
 		Settings.BitDepth = *SelectedBitDepth;
 
@@ -434,6 +1095,8 @@ void SQuickBakerWidget::OnOutputTypeChanged(TSharedPtr<EQuickBakerOutputType> Ne
 			EditorSettings->LastUsedOutputPath = Settings.OutputPath;
 			EditorSettings->SaveConfig();
 		}
+
+		RequestPreviewUpdate();
 	}
 }
 
@@ -451,6 +1114,21 @@ TSharedRef<SWidget> SQuickBakerWidget::GenerateOutputTypeWidget(TSharedPtr<EQuic
 	case EQuickBakerOutputType::EXR:
 		OutputTypeString = "EXR";
 		break;
+	case EQuickBakerOutputType::QOI:
+		OutputTypeString = "QOI";
+		break;
+	case EQuickBakerOutputType::TGA:
+		OutputTypeString = "TGA";
+		break;
+	case EQuickBakerOutputType::DDS:
+		OutputTypeString = "DDS";
+		break;
+	case EQuickBakerOutputType::NPY:
+		OutputTypeString = "NPY";
+		break;
+	case EQuickBakerOutputType::RAW:
+		OutputTypeString = "RAW";
+		break;
 	}
 	return SNew(STextBlock).Text(FText::FromString(OutputTypeString));
 }
@@ -473,10 +1151,99 @@ FText SQuickBakerWidget::GetSelectedOutputTypeText() const
 	case EQuickBakerOutputType::EXR:
 		OutputTypeString = "EXR";
 		break;
+	case EQuickBakerOutputType::QOI:
+		OutputTypeString = "QOI";
+		break;
+	case EQuickBakerOutputType::TGA:
+		OutputTypeString = "TGA";
+		break;
+	case EQuickBakerOutputType::DDS:
+		OutputTypeString = "DDS";
+		break;
+	case EQuickBakerOutputType::NPY:
+		OutputTypeString = "NPY";
+		break;
+	case EQuickBakerOutputType::RAW:
+		OutputTypeString = "RAW";
+		break;
 	}
 	return FText::FromString(OutputTypeString);
 }
 
+void SQuickBakerWidget::OnBakeModeChanged(TSharedPtr<EQuickBakerBakeMode> NewValue, ESelectInfo::Type SelectInfo)
+{
+	if (NewValue.IsValid())
+	{
+		SelectedBakeMode = NewValue;
+		Settings.BakeMode = *SelectedBakeMode;
+
+		// Save to config
+		UQuickBakerEditorSettings* EditorSettings = GetMutableDefault<UQuickBakerEditorSettings>();
+		if (EditorSettings)
+		{
+			EditorSettings->LastUsedBakeMode = static_cast<uint8>(Settings.BakeMode);
+			EditorSettings->SaveConfig();
+		}
+
+		RequestPreviewUpdate();
+	}
+}
+
+TSharedRef<SWidget> SQuickBakerWidget::GenerateBakeModeWidget(TSharedPtr<EQuickBakerBakeMode> InOption)
+{
+	FString BakeModeString;
+	if (InOption.IsValid())
+	{
+		switch (*InOption)
+		{
+		case EQuickBakerBakeMode::Single:
+			BakeModeString = "Single";
+			break;
+		case EQuickBakerBakeMode::Flipbook:
+			BakeModeString = "Flipbook";
+			break;
+		case EQuickBakerBakeMode::Cubemap:
+			BakeModeString = "Cubemap";
+			break;
+		case EQuickBakerBakeMode::UDIM:
+			BakeModeString = "UDIM";
+			break;
+		}
+	}
+	return SNew(STextBlock).Text(FText::FromString(BakeModeString));
+}
+
+FText SQuickBakerWidget::GetSelectedBakeModeText() const
+{
+	if (!SelectedBakeMode.IsValid())
+	{
+		return FText();
+	}
+	FString BakeModeString;
+	switch (*SelectedBakeMode)
+	{
+	case EQuickBakerBakeMode::Single:
+		BakeModeString = "Single";
+		break;
+	case EQuickBakerBakeMode::Flipbook:
+		BakeModeString = "Flipbook";
+		break;
+	case EQuickBakerBakeMode::Cubemap:
+		BakeModeString = "Cubemap";
+		break;
+	case EQuickBakerBakeMode::UDIM:
+		BakeModeString = "UDIM";
+		break;
+	}
+	return FText::FromString(BakeModeString);
+}
+
+EVisibility SQuickBakerWidget::GetFlipbookVisibility() const
+{
+	return (SelectedBakeMode.IsValid() && *SelectedBakeMode == EQuickBakerBakeMode::Flipbook)
+		? EVisibility::Visible : EVisibility::Collapsed;
+}
+
 void SQuickBakerWidget::OnMaterialChanged(const FAssetData& AssetData)
 {
 	Settings.SelectedMaterial = Cast<UMaterialInterface>(AssetData.GetAsset());
@@ -510,6 +1277,9 @@ void SQuickBakerWidget::OnMaterialChanged(const FAssetData& AssetData)
 	{
 		WarningTextBlock->SetVisibility(bShowMaterialWarning ? EVisibility::Visible : EVisibility::Collapsed);
 	}
+
+	RequestPreviewUpdate();
+	RefreshBakeHistory();
 }
 
 FString SQuickBakerWidget::GetSelectedMaterialPath() const
@@ -522,15 +1292,21 @@ void SQuickBakerWidget::OnResolutionChanged(TSharedPtr<int32> NewValue, ESelectI
 	if (NewValue.IsValid())
 	{
 		SelectedResolution = NewValue;
-		Settings.Resolution = *SelectedResolution;
+		Settings.Width = Settings.Height = *SelectedResolution;
+		OnResolutionCommitted(*SelectedResolution, ETextCommit::Default);
+		RequestPreviewUpdate();
+	}
+}
 
-		// Save to config
-		UQuickBakerEditorSettings* EditorSettings = GetMutableDefault<UQuickBakerEditorSettings>();
-		if (EditorSettings)
-		{
-			EditorSettings->LastUsedResolution = Settings.Resolution;
-			EditorSettings->SaveConfig();
-		}
+void SQuickBakerWidget::OnResolutionCommitted(int32 NewValue, ETextCommit::Type CommitType)
+{
+	// Save to config
+	UQuickBakerEditorSettings* EditorSettings = GetMutableDefault<UQuickBakerEditorSettings>();
+	if (EditorSettings)
+	{
+		EditorSettings->LastUsedWidth = Settings.Width;
+		EditorSettings->LastUsedHeight = Settings.Height;
+		EditorSettings->SaveConfig();
 	}
 }
 
@@ -541,7 +1317,28 @@ TSharedRef<SWidget> SQuickBakerWidget::GenerateResolutionWidget(TSharedPtr<int32
 
 FText SQuickBakerWidget::GetSelectedResolutionText() const
 {
-	return SelectedResolution.IsValid() ? FText::AsNumber(*SelectedResolution) : FText();
+	return LOCTEXT("Label_ResolutionPreset", "Preset");
+}
+
+FText SQuickBakerWidget::GetResolutionVariantsText() const
+{
+	return FText::FromString(FString::JoinBy(Settings.ResolutionVariants, TEXT(", "), [](int32 VariantWidth) { return FString::FromInt(VariantWidth); }));
+}
+
+void SQuickBakerWidget::OnResolutionVariantsCommitted(const FText& NewText, ETextCommit::Type CommitType)
+{
+	TArray<FString> Entries;
+	NewText.ToString().ParseIntoArrayWS(Entries, TEXT(","));
+
+	Settings.ResolutionVariants.Reset();
+	for (const FString& Entry : Entries)
+	{
+		const int32 VariantWidth = FCString::Atoi(*Entry);
+		if (VariantWidth > 0)
+		{
+			Settings.ResolutionVariants.AddUnique(VariantWidth);
+		}
+	}
 }
 
 void SQuickBakerWidget::OnBitDepthChanged(TSharedPtr<EQuickBakerBitDepth> NewValue, ESelectInfo::Type SelectInfo)
@@ -558,6 +1355,8 @@ void SQuickBakerWidget::OnBitDepthChanged(TSharedPtr<EQuickBakerBitDepth> NewVal
 			EditorSettings->LastUsedBitDepth = static_cast<uint8>(Settings.BitDepth);
 			EditorSettings->SaveConfig();
 		}
+
+		RequestPreviewUpdate();
 	}
 }
 
@@ -595,6 +1394,57 @@ void SQuickBakerWidget::OnCompressionChanged(TSharedPtr<TextureCompressionSettin
 			EditorSettings->LastUsedCompression = static_cast<uint8>(Settings.Compression);
 			EditorSettings->SaveConfig();
 		}
+
+		RequestPreviewUpdate();
+	}
+}
+
+void SQuickBakerWidget::OnUsageChanged(TSharedPtr<EQuickBakerTextureUsage> NewValue, ESelectInfo::Type SelectInfo)
+{
+	if (NewValue.IsValid())
+	{
+		SelectedUsage = NewValue;
+		Settings.Usage = *SelectedUsage;
+
+		// Save to config
+		UQuickBakerEditorSettings* EditorSettings = GetMutableDefault<UQuickBakerEditorSettings>();
+		if (EditorSettings)
+		{
+			EditorSettings->LastUsedUsage = static_cast<uint8>(Settings.Usage);
+			EditorSettings->SaveConfig();
+		}
+	}
+}
+
+TSharedRef<SWidget> SQuickBakerWidget::GenerateUsageWidget(TSharedPtr<EQuickBakerTextureUsage> InOption)
+{
+	FText DisplayName;
+	if (InOption.IsValid())
+	{
+		DisplayName = StaticEnum<EQuickBakerTextureUsage>()->GetDisplayNameTextByValue((int64)*InOption);
+	}
+	return SNew(STextBlock).Text(DisplayName);
+}
+
+FText SQuickBakerWidget::GetSelectedUsageText() const
+{
+	if (!SelectedUsage.IsValid())
+	{
+		return FText();
+	}
+	return StaticEnum<EQuickBakerTextureUsage>()->GetDisplayNameTextByValue((int64)*SelectedUsage);
+}
+
+void SQuickBakerWidget::OnCompressSourceChanged(ECheckBoxState NewState)
+{
+	Settings.bCompressSource = NewState == ECheckBoxState::Checked;
+
+	// Save to config
+	UQuickBakerEditorSettings* EditorSettings = GetMutableDefault<UQuickBakerEditorSettings>();
+	if (EditorSettings)
+	{
+		EditorSettings->bLastUsedCompressSource = Settings.bCompressSource;
+		EditorSettings->SaveConfig();
 	}
 }
 
@@ -625,6 +1475,91 @@ FText SQuickBakerWidget::GetSelectedCompressionText() const
 	return FText::FromString(EnumName);
 }
 
+FQuickBakerPostProcessStage* SQuickBakerWidget::FindPostProcessStage(EQuickBakerPostProcessType Type)
+{
+	return Settings.PostProcessStages.FindByPredicate([Type](const FQuickBakerPostProcessStage& Stage) { return Stage.Type == Type; });
+}
+
+void SQuickBakerWidget::OnPostProcessStageToggled(ECheckBoxState NewState, EQuickBakerPostProcessType Type)
+{
+	TArray<FQuickBakerPostProcessStage>& Stages = Settings.PostProcessStages;
+	if (NewState != ECheckBoxState::Checked)
+	{
+		Stages.RemoveAll([Type](const FQuickBakerPostProcessStage& Stage) { return Stage.Type == Type; });
+		RequestPreviewUpdate();
+		return;
+	}
+
+	if (FindPostProcessStage(Type))
+	{
+		return;
+	}
+
+	// The enum order is the order the stages run in
+	int32 InsertIndex = 0;
+	while (InsertIndex < Stages.Num() && Stages[InsertIndex].Type < Type)
+	{
+		++InsertIndex;
+	}
+	Stages.Insert(FQuickBakerPostProcessStage(Type), InsertIndex);
+	RequestPreviewUpdate();
+}
+
+TSharedRef<SWidget> SQuickBakerWidget::MakePostProcessRow(EQuickBakerPostProcessType Type, const FText& Label, const FText& ToolTip, TSharedRef<SWidget> Parameters)
+{
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		[
+			SNew(SCheckBox)
+			.ToolTipText(ToolTip)
+			.IsChecked_Lambda([this, Type] { return FindPostProcessStage(Type) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged_Raw(this, &SQuickBakerWidget::OnPostProcessStageToggled, Type)
+			[
+				SNew(SBox)
+				.MinDesiredWidth(80.0f)
+				[
+					SNew(STextBlock).Text(Label)
+				]
+			]
+		]
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(5, 0, 0, 0)
+		[
+			SNew(SBox)
+			.IsEnabled_Lambda([this, Type] { return FindPostProcessStage(Type) != nullptr; })
+			[
+				Parameters
+			]
+		];
+}
+
+TSharedRef<SWidget> SQuickBakerWidget::MakePostProcessValueBox(EQuickBakerPostProcessType Type, float FQuickBakerPostProcessStage::* Member, float MinValue, float MaxValue, const FText& ToolTip)
+{
+	// Disabled boxes show the value a newly enabled stage would start with
+	static const FQuickBakerPostProcessStage DefaultStage;
+
+	return SNew(SNumericEntryBox<float>)
+		.ToolTipText(ToolTip)
+		.MinValue(MinValue)
+		.MaxValue(MaxValue)
+		.Value_Lambda([this, Type, Member]
+		{
+			const FQuickBakerPostProcessStage* Stage = FindPostProcessStage(Type);
+			return TOptional<float>((Stage ? *Stage : DefaultStage).*Member);
+		})
+		.OnValueChanged_Lambda([this, Type, Member](float NewValue)
+		{
+			if (FQuickBakerPostProcessStage* Stage = FindPostProcessStage(Type))
+			{
+				Stage->*Member = NewValue;
+				RequestPreviewUpdate();
+			}
+		});
+}
+
 void SQuickBakerWidget::OnOutputNameChanged(const FText& NewText)
 {
 	Settings.OutputName = NewText.ToString();
@@ -639,6 +1574,19 @@ FReply SQuickBakerWidget::OnBakeClicked()
 		return FReply::Handled();
 	}
 
+	if (Settings.BakeMode == EQuickBakerBakeMode::Flipbook
+		&& (int64)Settings.FlipbookColumns * Settings.FlipbookRows < Settings.FlipbookFrameCount)
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Error_FlipbookGrid", "The flipbook grid has fewer cells than frames. Increase Columns or Rows."));
+		return FReply::Handled();
+	}
+
+	if (Settings.BakeMode == EQuickBakerBakeMode::Cubemap && Settings.Width != Settings.Height)
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Error_CubemapNotSquare", "Cubemap faces must be square. Set Width and Height to the same value."));
+		return FReply::Handled();
+	}
+
 	if (!Settings.IsValid())
 	{
 		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Error_InvalidSettings", "Invalid bake settings."));
@@ -674,7 +1622,7 @@ FReply SQuickBakerWidget::OnBakeClicked()
 	}
 	else
 	{
-		// PNG or EXR
+		// File output
 		if (!IFileManager::Get().DirectoryExists(*Settings.OutputPath))
 		{
 			FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("Error_InvalidDir", "Output directory does not exist: {0}"), FText::FromString(Settings.OutputPath)));
@@ -683,13 +1631,15 @@ FReply SQuickBakerWidget::OnBakeClicked()
 	}
 
 	// Warn user about large texture resolution and estimated memory usage
-	if (Settings.Resolution > LargeTextureWarningThreshold)
+	const FIntPoint OutputSize = Settings.GetOutputSize();
+	if (FMath::Max(OutputSize.X, OutputSize.Y) > LargeTextureWarningThreshold)
 	{
-		const int64 EstimatedMB = (int64)Settings.Resolution * Settings.Resolution * 8 / (1024 * 1024);
+		const int64 EstimatedMB = (int64)OutputSize.X * OutputSize.Y * 8 / (1024 * 1024);
 		FText WarningMessage = FText::Format(
 			LOCTEXT("Warning_LargeResolution",
-				"This resolution ({0}x{0}) will consume a very large amount of memory (~{1} MB for RGBA16f). Processing may become unstable. Continue?"),
-			FText::AsNumber(Settings.Resolution),
+				"This resolution ({0}x{1}) will consume a very large amount of memory (~{2} MB for RGBA16f). Processing may become unstable. Continue?"),
+			FText::AsNumber(OutputSize.X),
+			FText::AsNumber(OutputSize.Y),
 			FText::AsNumber(EstimatedMB));
 		if (FMessageDialog::Open(EAppMsgType::YesNo, WarningMessage) != EAppReturnType::Yes)
 		{
@@ -698,9 +1648,88 @@ FReply SQuickBakerWidget::OnBakeClicked()
 	}
 
 	FQuickBakerCore::ExecuteBake(Settings);
+	RefreshBakeHistory();
 	return FReply::Handled();
 }
 
+void SQuickBakerWidget::OnBakeHistoryExpansionChanged(bool bExpanded)
+{
+	bBakeHistoryExpanded = bExpanded;
+	RefreshBakeHistory();
+}
+
+void SQuickBakerWidget::RefreshBakeHistory()
+{
+	if (!bBakeHistoryExpanded)
+	{
+		return;
+	}
+
+	static constexpr int32 NumTrendRecords = 8;
+	static constexpr int32 NumSlowestMaterials = 5;
+
+	const TArray<FQuickBakerBakeRecord> Records = FQuickBakerBakeHistory::Load();
+	if (Records.IsEmpty())
+	{
+		BakeHistoryText = LOCTEXT("BakeHistory_Empty", "No bakes recorded yet.");
+		return;
+	}
+
+	FNumberFormattingOptions TwoDecimals;
+	TwoDecimals.SetMinimumFractionalDigits(2).SetMaximumFractionalDigits(2);
+
+	TArray<FText> Lines;
+
+	// Recent bakes of the selected material, with the latest compared to the median of the ones before it
+	const TArray<FQuickBakerBakeRecord> Trend = FQuickBakerBakeHistory::GetMaterialTrend(Records, GetSelectedMaterialPath(), NumTrendRecords);
+	if (Trend.Num() > 0)
+	{
+		Lines.Add(LOCTEXT("BakeHistory_TrendHeader", "Recent bakes of this material:"));
+		for (const FQuickBakerBakeRecord& Record : Trend)
+		{
+			Lines.Add(FText::Format(LOCTEXT("BakeHistory_TrendLine", "  {0}  {1}x{2} {3}  {4} s  {5} MPix/s"),
+				FText::AsDateTime(Record.Timestamp, EDateTimeStyle::Short, EDateTimeStyle::Short),
+				FText::AsNumber(Record.Width, &FNumberFormattingOptions::DefaultNoGrouping()),
+				FText::AsNumber(Record.Height, &FNumberFormattingOptions::DefaultNoGrouping()),
+				FText::FromString(Record.OutputType),
+				FText::AsNumber(Record.TotalSeconds, &TwoDecimals),
+				FText::AsNumber(Record.GetMegapixelsPerSecond(), &TwoDecimals)));
+		}
+
+		if (Trend.Num() > 1)
+		{
+			TArray<double> Earlier;
+			for (int32 Index = 0; Index < Trend.Num() - 1; ++Index)
+			{
+				Earlier.Add(Trend[Index].GetMegapixelsPerSecond());
+			}
+			Earlier.Sort();
+			const double Median = Earlier[Earlier.Num() / 2];
+			if (Median > 0.0)
+			{
+				Lines.Add(FText::Format(LOCTEXT("BakeHistory_TrendChange", "  Latest vs. earlier median: {0}"),
+					FText::AsPercent(Trend.Last().GetMegapixelsPerSecond() / Median - 1.0)));
+			}
+		}
+	}
+
+	const TArray<FQuickBakerMaterialSummary> Slowest = FQuickBakerBakeHistory::GetSlowestMaterials(Records, NumSlowestMaterials);
+	if (Slowest.Num() > 0)
+	{
+		Lines.Add(LOCTEXT("BakeHistory_SlowestHeader", "Slowest materials (median MPix/s):"));
+		for (const FQuickBakerMaterialSummary& Summary : Slowest)
+		{
+			Lines.Add(FText::Format(LOCTEXT("BakeHistory_SlowestLine", "  {0}  {1} MPix/s, latest {2} ({3} bakes)"),
+				FText::FromString(FPackageName::ObjectPathToObjectName(Summary.Material)),
+				FText::AsNumber(Summary.MedianMegapixelsPerSecond, &TwoDecimals),
+				FText::AsNumber(Summary.LatestMegapixelsPerSecond, &TwoDecimals),
+				FText::AsNumber(Summary.NumBakes)));
+		}
+	}
+
+	BakeHistoryText = FText::Join(FText::FromString(TEXT("\n")), Lines);
+}
+
 FReply SQuickBakerWidget::OnBrowseClicked()
 {
 	if (!SelectedOutputType.IsValid())
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerBatch.h"
+#include "QuickBakerCancellation.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "ImageCore.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace QuickBakerAssetFormatTests
+{
+	/** Content folder the test assets are baked into and deleted from. */
+	static const TCHAR* OutputPath = TEXT("/Game/QuickBakerTests");
+
+	/** Gets the settings of a small asset bake of a material with a grid pattern. */
+	static FQuickBakerSettings MakeSettings(UMaterialInterface* Material, const FString& OutputName)
+	{
+		FQuickBakerSettings Settings;
+		Settings.SelectedMaterial = Material;
+		Settings.OutputType = EQuickBakerOutputType::Asset;
+		Settings.Width = 64;
+		Settings.Height = 64;
+		Settings.BitDepth = EQuickBakerBitDepth::Bit16;
+		Settings.bSkipUnchangedAssets = false;
+		Settings.OutputName = OutputName;
+		Settings.OutputPath = OutputPath;
+		return Settings;
+	}
+
+	/** Bakes one asset and reads its source back as floats. Returns false if the bake or the read failed. */
+	static bool BakeAndRead(const FQuickBakerSettings& Settings, ETextureSourceFormat& OutFormat, FImage& OutImage)
+	{
+		FQuickBakerCancellationToken CancellationToken;
+		FQuickBakerBatchStats Stats;
+		if (!FQuickBakerBatch::Execute(MakeArrayView(&Settings, 1), CancellationToken, Stats))
+		{
+			return false;
+		}
+
+		const FString PackageName = FString(OutputPath) / Settings.OutputName;
+		UTexture2D* Texture = LoadObject<UTexture2D>(nullptr, *(PackageName + TEXT(".") + Settings.OutputName));
+		if (!Texture || !Texture->Source.GetMipImage(OutImage, 0, 0, 0))
+		{
+			return false;
+		}
+
+		OutFormat = Texture->Source.GetFormat();
+		OutImage.ChangeFormat(ERawImageFormat::R32F, EGammaSpace::Linear);
+		return true;
+	}
+
+	/** Deletes the package file of a test asset; the loaded object goes with the next garbage collection. */
+	static void DeleteAsset(const FString& OutputName)
+	{
+		const FString PackageName = FString(OutputPath) / OutputName;
+		IFileManager::Get().Delete(*FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension()), false, true, true);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuickBakerGrayscaleDistanceFieldTest, "QuickBaker.AssetFormat.GrayscaleDistanceField", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuickBakerGrayscaleDistanceFieldTest::RunTest(const FString& Parameters)
+{
+	using namespace QuickBakerAssetFormatTests;
+
+	TStrongObjectPtr<UMaterialInterface> Material(LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/EngineMaterials/WorldGridMaterial.WorldGridMaterial")));
+	if (!Material.IsValid())
+	{
+		AddError(TEXT("WorldGridMaterial could not be loaded."));
+		return false;
+	}
+
+	ON_SCOPE_EXIT
+	{
+		DeleteAsset(TEXT("T_QuickBakerTest_Mask"));
+		DeleteAsset(TEXT("T_QuickBakerTest_Distance"));
+	};
+
+	// The mask is baked at full float precision first, so the threshold splits it into inside and outside pixels
+	FQuickBakerSettings MaskSettings = MakeSettings(Material.Get(), TEXT("T_QuickBakerTest_Mask"));
+	MaskSettings.Compression = TC_SingleFloat;
+
+	ETextureSourceFormat MaskFormat = TSF_Invalid;
+	FImage Mask;
+	if (!BakeAndRead(MaskSettings, MaskFormat, Mask))
+	{
+		AddError(TEXT("The mask could not be baked."));
+		return false;
+	}
+
+	float MaskMin = FLT_MAX;
+	float MaskMax = -FLT_MAX;
+	for (const float Value : Mask.AsR32F())
+	{
+		MaskMin = FMath::Min(MaskMin, Value);
+		MaskMax = FMath::Max(MaskMax, Value);
+	}
+	if (!TestTrue(TEXT("Mask has inside and outside pixels"), MaskMin < MaskMax))
+	{
+		return false;
+	}
+
+	FQuickBakerSettings DistanceSettings = MakeSettings(Material.Get(), TEXT("T_QuickBakerTest_Distance"));
+	DistanceSettings.Compression = TC_Grayscale;
+	FQuickBakerPostProcessStage& Stage = DistanceSettings.PostProcessStages.Emplace_GetRef(EQuickBakerPostProcessType::SignedDistance);
+	Stage.Radius = 8.0f;
+	Stage.Threshold = (MaskMin + MaskMax) * 0.5f;
+
+	ETextureSourceFormat DistanceFormat = TSF_Invalid;
+	FImage Distance;
+	if (!BakeAndRead(DistanceSettings, DistanceFormat, Distance))
+	{
+		AddError(TEXT("The distance field could not be baked."));
+		return false;
+	}
+
+	// A 16-bit grayscale asset keeps the half floats of the target, including the negative outside half
+	TestEqual(TEXT("16-bit grayscale is stored as R16F"), (int32)DistanceFormat, (int32)TSF_R16F);
+
+	float DistanceMin = FLT_MAX;
+	float DistanceMax = -FLT_MAX;
+	for (const float Value : Distance.AsR32F())
+	{
+		DistanceMin = FMath::Min(DistanceMin, Value);
+		DistanceMax = FMath::Max(DistanceMax, Value);
+	}
+	TestTrue(TEXT("Outside pixels keep negative distances"), DistanceMin < 0.0f);
+	TestTrue(TEXT("Inside pixels keep positive distances"), DistanceMax > 0.0f);
+	TestTrue(TEXT("Distances stay within [-1, 1]"), DistanceMin >= -1.0f && DistanceMax <= 1.0f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerDistanceField.h"
+#include "QuickBakerCancellation.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace QuickBakerDistanceFieldTests
+{
+	/** Different sizes, so columns and rows transform lines of different lengths. */
+	static constexpr int32 Width = 24;
+	static constexpr int32 Height = 17;
+
+	/** Mask value above which a pixel is inside. */
+	static constexpr float Threshold = 0.5f;
+
+	/** Fills a mask with a disc, a bar touching the border and a single pixel, with values either side of the threshold. */
+	static TArray<float> MakeMask()
+	{
+		TArray<float> Mask;
+		Mask.SetNumUninitialized(Width * Height);
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const bool bDisc = FMath::Square(X - 7) + FMath::Square(Y - 8) <= 20;
+				const bool bBar = X >= 16 && X <= 18 && Y >= 3;
+				const bool bDot = X == 22 && Y == 1;
+				Mask[Y * Width + X] = (bDisc || bBar || bDot) ? 0.75f : 0.25f;
+			}
+		}
+		return Mask;
+	}
+
+	/**
+	 * Computes the signed distance field by brute force, in the GPU stage's encoding: the edge lies halfway between
+	 * pixel centers, so inside pixels are their distance to the nearest outside pixel minus 0.5 and outside pixels 0.5
+	 * minus their distance to the nearest inside pixel, divided by Spread and clamped to [-1, 1].
+	 */
+	static TArray<float> BruteForce(const TArray<float>& Mask, float Spread)
+	{
+		TArray<float> Distance;
+		Distance.SetNumUninitialized(Width * Height);
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const bool bInside = Mask[Y * Width + X] > Threshold;
+				double Nearest = DBL_MAX;
+				for (int32 OtherY = 0; OtherY < Height; ++OtherY)
+				{
+					for (int32 OtherX = 0; OtherX < Width; ++OtherX)
+					{
+						if ((Mask[OtherY * Width + OtherX] > Threshold) != bInside)
+						{
+							Nearest = FMath::Min(Nearest, FMath::Sqrt((double)FMath::Square(X - OtherX) + FMath::Square(Y - OtherY)));
+						}
+					}
+				}
+
+				const double Signed = bInside ? Nearest - 0.5 : 0.5 - Nearest;
+				Distance[Y * Width + X] = (float)FMath::Clamp(Signed / Spread, -1.0, 1.0);
+			}
+		}
+		return Distance;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuickBakerDistanceFieldTest, "QuickBaker.DistanceField", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuickBakerDistanceFieldTest::RunTest(const FString& Parameters)
+{
+	using namespace QuickBakerDistanceFieldTests;
+
+	const TArray<float> Mask = MakeMask();
+	FQuickBakerCancellationToken CancellationToken;
+
+	// A wide spread keeps every distance unclamped; the narrow ones clamp most of the image to -1 or 1
+	for (const float Spread : { 32.0f, 3.0f, 1.0f })
+	{
+		const TArray<float> Expected = BruteForce(Mask, Spread);
+
+		TArray<float> Distance;
+		Distance.SetNumZeroed(Width * Height);
+		if (!TestTrue(FString::Printf(TEXT("Generate succeeds with spread %g"), Spread), FQuickBakerDistanceField::Generate(Mask.GetData(), Width, Height, Threshold, Spread, Distance.GetData(), CancellationToken)))
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < Width * Height; ++Index)
+		{
+			if (!FMath::IsNearlyEqual(Distance[Index], Expected[Index], 1.0e-4f))
+			{
+				AddError(FString::Printf(TEXT("Spread %g: pixel (%d, %d) is %f, expected %f."), Spread, Index % Width, Index / Width, Distance[Index], Expected[Index]));
+				return false;
+			}
+		}
+
+		// Pixels either side of the edge sit half a pixel from it
+		TestEqual(FString::Printf(TEXT("Single inside pixel with spread %g"), Spread), Distance[1 * Width + 22], 0.5f / Spread);
+		TestEqual(FString::Printf(TEXT("Outside pixel next to it with spread %g"), Spread), Distance[1 * Width + 21], -0.5f / Spread);
+	}
+
+	// The output may be the mask itself
+	TArray<float> InPlace = Mask;
+	const TArray<float> Expected = BruteForce(Mask, 4.0f);
+	if (!TestTrue(TEXT("Generate succeeds in place"), FQuickBakerDistanceField::Generate(InPlace.GetData(), Width, Height, Threshold, 4.0f, InPlace.GetData(), CancellationToken)))
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Width * Height; ++Index)
+	{
+		if (!FMath::IsNearlyEqual(InPlace[Index], Expected[Index], 1.0e-4f))
+		{
+			AddError(FString::Printf(TEXT("In place: pixel (%d, %d) is %f, expected %f."), Index % Width, Index / Width, InPlace[Index], Expected[Index]));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerBatch.h"
+#include "QuickBakerCancellation.h"
+#include "QuickBakerImageDiff.h"
+#include "QuickBakerJobFile.h"
+#include "ImageCore.h"
+#include "ImageUtils.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace QuickBakerGoldenTests
+{
+	/** Largest channel difference allowed for 8-bit outputs: one step. */
+	static constexpr float MaxErrorBytes = 1.0f / 255.0f;
+
+	/** Largest channel difference allowed for float outputs, which GPUs may round differently. */
+	static constexpr float MaxErrorFloat = 1.0e-3f;
+
+	/**
+	 * Gets the smallest PSNR allowed for an output: that of an image off by the largest allowed error everywhere,
+	 * so the two checks agree on what passes (about 48 dB for 8-bit, 60 dB for float outputs).
+	 */
+	static double GetMinPSNR(float MaxError)
+	{
+		return -20.0 * FMath::LogX(10.0, (double)MaxError);
+	}
+
+	/** Gets the folder holding Jobs.json and the golden images. */
+	static FString GetGoldenDirectory()
+	{
+		return FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("QuickBaker"))->GetBaseDir(), TEXT("Tests"), TEXT("Golden"));
+	}
+
+	/** Gets whether a file is an image the engine can load for comparison. */
+	static bool IsComparableImage(const FString& FileName)
+	{
+		const FString Extension = FPaths::GetExtension(FileName);
+		return Extension == TEXT("png") || Extension == TEXT("exr") || Extension == TEXT("tga");
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuickBakerGoldenTest, "QuickBaker.Golden.Bake", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuickBakerGoldenTest::RunTest(const FString& Parameters)
+{
+	using namespace QuickBakerGoldenTests;
+
+	const FString GoldenDirectory = GetGoldenDirectory();
+	TArray<FQuickBakerSettings> Jobs;
+	if (!FQuickBakerJobFile::Load(FPaths::Combine(GoldenDirectory, TEXT("Jobs.json")), Jobs))
+	{
+		AddError(TEXT("Could not read Tests/Golden/Jobs.json."));
+		return false;
+	}
+
+	// Outputs go to a fresh transient folder, so that only this run's files are compared
+	const FString OutputDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("QuickBaker"));
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+	IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+
+	TArray<TStrongObjectPtr<UMaterialInterface>> Materials;
+	for (FQuickBakerSettings& Settings : Jobs)
+	{
+		if (Settings.OutputType == EQuickBakerOutputType::Asset || !IsComparableImage(Settings.GetOutputFilePath()))
+		{
+			AddError(FString::Printf(TEXT("%s: Golden jobs must write PNG, EXR or TGA files."), *Settings.OutputName));
+			return false;
+		}
+		if (!Settings.SelectedMaterial.IsValid())
+		{
+			AddError(FString::Printf(TEXT("%s: Material could not be loaded."), *Settings.OutputName));
+			return false;
+		}
+		Materials.Emplace(Settings.SelectedMaterial.Get());
+		Settings.OutputPath = OutputDirectory;
+	}
+
+	FQuickBakerCancellationToken CancellationToken;
+	FQuickBakerBatchStats Stats;
+	TestTrue(TEXT("Batch succeeded"), FQuickBakerBatch::Execute(Jobs, CancellationToken, Stats));
+
+	// Every file written, including variants and UDIM tiles, is compared with the golden of the same name
+	TArray<FString> OutputFiles;
+	IFileManager::Get().FindFiles(OutputFiles, *OutputDirectory, nullptr);
+	OutputFiles.RemoveAll([](const FString& FileName) { return !IsComparableImage(FileName); });
+	OutputFiles.Sort();
+	TestTrue(TEXT("Batch wrote files"), OutputFiles.Num() > 0);
+
+	// Every output must have a golden; only an update run may create them
+	const bool bUpdateGoldens = FParse::Param(FCommandLine::Get(), TEXT("QuickBakerUpdateGoldens"));
+	for (const FString& FileName : OutputFiles)
+	{
+		const FString OutputFile = FPaths::Combine(OutputDirectory, FileName);
+		const FString GoldenFile = FPaths::Combine(GoldenDirectory, FileName);
+
+		if (bUpdateGoldens)
+		{
+			TestEqual(*FString::Printf(TEXT("%s: Golden updated"), *FileName), IFileManager::Get().Copy(*GoldenFile, *OutputFile), (uint32)COPY_OK);
+			continue;
+		}
+
+		FImage Golden;
+		if (!FImageUtils::LoadImage(*GoldenFile, Golden))
+		{
+			AddError(FString::Printf(TEXT("%s: No golden image. Run with -QuickBakerUpdateGoldens to create it."), *FileName));
+			continue;
+		}
+
+		FImage Output;
+		if (!FImageUtils::LoadImage(*OutputFile, Output))
+		{
+			AddError(FString::Printf(TEXT("%s: Output could not be loaded."), *FileName));
+			continue;
+		}
+
+		const float MaxError = ERawImageFormat::IsHDR(Golden.Format) ? MaxErrorFloat : MaxErrorBytes;
+		FQuickBakerImageDiffResult Result;
+		if (!FQuickBakerImageDiff::Compare(Golden, Output, Result, MaxError))
+		{
+			AddError(FString::Printf(TEXT("%s: Size %dx%d does not match the golden %dx%d."), *FileName, Output.SizeX, Output.SizeY, Golden.SizeX, Golden.SizeY));
+			continue;
+		}
+
+		if (Result.MaxError > MaxError || Result.PSNR < GetMinPSNR(MaxError))
+		{
+			// The heatmap is kept next to the output, scaled so that ten times the tolerance is white
+			const FString DiffFile = FPaths::Combine(OutputDirectory, FPaths::GetBaseFilename(FileName) + TEXT("_diff.png"));
+			FImage Heatmap;
+			if (FQuickBakerImageDiff::MakeHeatmap(Golden, Output, MaxError * 10.0f, Heatmap))
+			{
+				FImageUtils::SaveImageByExtension(*DiffFile, Heatmap);
+			}
+			AddError(FString::Printf(TEXT("%s: %s. Heatmap: %s"), *FileName, *Result.ToString(), *DiffFile));
+		}
+		else
+		{
+			AddInfo(FString::Printf(TEXT("%s: %s"), *FileName, *Result.ToString()));
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerImageDiff.h"
+#include "ImageCore.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace QuickBakerImageDiffTests
+{
+	/** Odd sizes, so the last block of rows is partial. */
+	static constexpr int32 Width = 37;
+	static constexpr int32 Height = 70;
+
+	/** Fills an 8-bit image with a gradient. */
+	static void FillGradient(FImage& Image)
+	{
+		Image.Init(Width, Height, ERawImageFormat::BGRA8, EGammaSpace::Linear);
+		const TArrayView64<FColor> Pixels = Image.AsBGRA8();
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			for (int32 X = 0; X < Width; ++X)
+			{
+				Pixels[(int64)Y * Width + X] = FColor((uint8)(X * 6), (uint8)(Y * 3), (uint8)(X + Y), 255);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuickBakerImageDiffTest, "QuickBaker.ImageDiff", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuickBakerImageDiffTest::RunTest(const FString& Parameters)
+{
+	using namespace QuickBakerImageDiffTests;
+
+	FImage Golden;
+	FillGradient(Golden);
+	FImage Output;
+	FillGradient(Output);
+
+	// Identical images
+	FQuickBakerImageDiffResult Result;
+	TestTrue(TEXT("Identical images compare"), FQuickBakerImageDiff::Compare(Golden, Output, Result));
+	TestEqual(TEXT("Identical images have no error"), Result.MaxError, 0.0f);
+	TestEqual(TEXT("Identical images have no differing pixels"), Result.NumDifferentPixels, (int64)0);
+	TestEqual(TEXT("Identical images have no max error pixel"), Result.MaxErrorPixel, FIntPoint(-1, -1));
+	TestTrue(TEXT("Identical images have infinite PSNR"), Result.PSNR > 1000.0);
+
+	// One channel of one pixel off by 51 / 255 = 0.2
+	const FIntPoint ChangedPixel(13, 45);
+	Output.AsBGRA8()[(int64)ChangedPixel.Y * Width + ChangedPixel.X].G += 51;
+	TestTrue(TEXT("Changed images compare"), FQuickBakerImageDiff::Compare(Golden, Output, Result));
+	TestEqual(TEXT("Max error is the changed channel"), Result.MaxError, 0.2f, 1.0e-6f);
+	TestEqual(TEXT("Max error pixel is the changed pixel"), Result.MaxErrorPixel, ChangedPixel);
+	TestEqual(TEXT("One pixel differs"), Result.NumDifferentPixels, (int64)1);
+
+	const double ExpectedMSE = 0.04 / (Width * Height * 4.0);
+	TestEqual(TEXT("MSE of one changed channel"), Result.MeanSquaredError, ExpectedMSE, ExpectedMSE * 1.0e-4);
+	TestEqual(TEXT("PSNR of one changed channel"), Result.PSNR, 10.0 * FMath::LogX(10.0, 1.0 / ExpectedMSE), 1.0e-3);
+
+	// The threshold leaves out smaller differences
+	TestTrue(TEXT("Thresholded images compare"), FQuickBakerImageDiff::Compare(Golden, Output, Result, 0.25f));
+	TestEqual(TEXT("No pixel differs above the threshold"), Result.NumDifferentPixels, (int64)0);
+
+	// The float path gives the same result as the 8-bit path
+	FImage GoldenFloat;
+	Golden.CopyTo(GoldenFloat, ERawImageFormat::RGBA16F, EGammaSpace::Linear);
+	TestTrue(TEXT("Mixed formats compare"), FQuickBakerImageDiff::Compare(GoldenFloat, Output, Result));
+	TestEqual(TEXT("Float max error"), Result.MaxError, 0.2f, 1.0e-3f);
+	TestEqual(TEXT("Float max error pixel"), Result.MaxErrorPixel, ChangedPixel);
+
+	// Heatmap: only the changed pixel lights up
+	FImage Heatmap;
+	TestTrue(TEXT("Heatmap is built"), FQuickBakerImageDiff::MakeHeatmap(Golden, Output, 0.2f, Heatmap));
+	const TArrayView64<FColor> Heat = Heatmap.AsBGRA8();
+	TestEqual(TEXT("Full scale error is white"), Heat[(int64)ChangedPixel.Y * Width + ChangedPixel.X], FColor::White);
+	TestEqual(TEXT("Matching pixels are black"), Heat[0], FColor::Black);
+
+	// Images of different sizes are not compared
+	FImage Smaller(Width - 1, Height, ERawImageFormat::BGRA8, EGammaSpace::Linear);
+	TestFalse(TEXT("Different sizes do not compare"), FQuickBakerImageDiff::Compare(Golden, Smaller, Result));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
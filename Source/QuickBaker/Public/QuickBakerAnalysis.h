@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Texture.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * Value statistics of a baked image, gathered in parallel after readback.
+ * Channels are always in RGBA order, whatever the memory layout of the source format.
+ */
+struct QUICKBAKER_API FQuickBakerImageStats
+{
+	/** Number of channels the source format holds (1 or 4). */
+	int32 NumChannels = 0;
+
+	/** Per-channel minimum. */
+	FLinearColor Min = FLinearColor(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX);
+
+	/** Per-channel maximum. */
+	FLinearColor Max = FLinearColor(-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	/** Largest per-channel error when storing the values directly as 8-bit unorm (only meaningful within [0, 1]). */
+	FLinearColor DirectError8 = FLinearColor::Black;
+
+	/** Largest per-channel error when storing the values as 8-bit remapped from [Min, Max]. */
+	FLinearColor RemapError8 = FLinearColor::Black;
+
+	/** Per-channel histogram over [Min, Max], 256 bins each, RGBA channels consecutive. */
+	TArray<uint32> Histogram;
+
+	/** True if alpha has the same value everywhere (always true for single-channel formats). */
+	bool bConstantAlpha = true;
+
+	/** True if R, G and B are equal in every pixel (always true for single-channel formats). */
+	bool bGrayscale = true;
+
+	/** True if every pixel has the same value. */
+	bool bConstantColor = true;
+
+	/**
+	 * Counts the histogram bins of a channel that hold at least one pixel.
+	 *
+	 * @param Channel The channel index in RGBA order.
+	 * @return The number of occupied bins, at most 256.
+	 */
+	int32 GetUsedLevels(int32 Channel) const;
+};
+
+/**
+ * The storage chosen for a baked image by FQuickBakerAnalysis::ChooseFormat.
+ * Stored values map back to the baked values as Value = Stored * Scale + Bias.
+ */
+struct QUICKBAKER_API FQuickBakerFormatChoice
+{
+	/** The texture source format to store. */
+	ETextureSourceFormat Format = TSF_Invalid;
+
+	/** The compression setting matching Format. */
+	TextureCompressionSettings Compression = TC_Default;
+
+	/** The source size; 4x4 when a constant image was collapsed. */
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	/** Per-channel scale applied when sampling the stored values. */
+	FLinearColor Scale = FLinearColor::White;
+
+	/** Per-channel bias applied when sampling the stored values. */
+	FLinearColor Bias = FLinearColor::Transparent;
+
+	/** Value of the dropped alpha channel when a constant-alpha image was stored without alpha. */
+	float ConstantAlpha = 1.0f;
+
+	/** True if Scale and Bias differ from the identity mapping. */
+	bool IsRemapped() const
+	{
+		return !Scale.Equals(FLinearColor::White, 0.0f) || !Bias.Equals(FLinearColor::Transparent, 0.0f);
+	}
+};
+
+/**
+ * Data analysis pass for asset bakes.
+ * Measures the value range and structure of a baked image, then picks the smallest texture source format that stays
+ * within a given error: single-channel storage for grayscale images, 8 bits (optionally range-remapped) for data
+ * baked at 16 bits "to be safe", and a 4x4 texture for constant images.
+ */
+class QUICKBAKER_API FQuickBakerAnalysis
+{
+public:
+	/**
+	 * Gathers statistics in two parallel passes (range and structure, then quantization error and histogram).
+	 *
+	 * @param Pixels The source pixels, tightly packed.
+	 * @param NumPixels The number of pixels.
+	 * @param Format The texture source format of Pixels (BGRA8, RGBA16F, G8, G16, R16F or R32F).
+	 * @param OutStats Receives the statistics.
+	 * @param CancellationToken Checked between blocks.
+	 * @return True if the statistics are complete, false for unsupported formats or cancellation.
+	 */
+	static bool Analyze(const uint8* Pixels, int64 NumPixels, ETextureSourceFormat Format, FQuickBakerImageStats& OutStats, FQuickBakerCancellationToken& CancellationToken);
+
+	/**
+	 * Picks the storage for an image. Only formats whose error stays within MaxError are considered.
+	 * Compression settings with a fixed meaning (normal maps, masks, alpha) keep their format.
+	 *
+	 * @param Stats The statistics from Analyze.
+	 * @param Format The current texture source format.
+	 * @param Compression The requested compression setting.
+	 * @param Size The current source size.
+	 * @param bAllowRemap True to allow remapping a channel's [Min, Max] range into 8 bits.
+	 * @param MaxError The largest acceptable per-channel error in value units.
+	 * @return The chosen storage; equal to the input format and size if nothing smaller qualifies.
+	 */
+	static FQuickBakerFormatChoice ChooseFormat(const FQuickBakerImageStats& Stats, ETextureSourceFormat Format, TextureCompressionSettings Compression, const FIntPoint& Size, bool bAllowRemap, float MaxError);
+
+	/**
+	 * Converts pixels into the chosen storage.
+	 *
+	 * @param Pixels The source pixels, tightly packed.
+	 * @param NumPixels The number of source pixels.
+	 * @param Format The texture source format of Pixels.
+	 * @param Choice The storage from ChooseFormat.
+	 * @param OutPixels Receives Choice.Size pixels in Choice.Format.
+	 * @param CancellationToken Checked between blocks.
+	 * @return True if converted, false on cancellation.
+	 */
+	static bool ConvertPixels(const uint8* Pixels, int64 NumPixels, ETextureSourceFormat Format, const FQuickBakerFormatChoice& Choice, TArray64<uint8>& OutPixels, FQuickBakerCancellationToken& CancellationToken);
+};
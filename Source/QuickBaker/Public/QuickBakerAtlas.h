@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * One material baked into a region of an atlas.
+ */
+struct QUICKBAKER_API FQuickBakerAtlasItem
+{
+	/** The material to bake. The caller keeps it alive. */
+	TWeakObjectPtr<UMaterialInterface> Material;
+
+	/** Size of the item's region in pixels. */
+	FIntPoint Size = FIntPoint(256, 256);
+
+	/** Name the item is looked up by. None for the material's name; repeated names get a _<N> suffix. */
+	FName Name;
+};
+
+/**
+ * Bakes many small materials (icons, decals, masks) into one shared texture.
+ * The items are packed into a power-of-two atlas, drawn into one pooled render target in a single render graph, read
+ * back once and saved once, instead of one render, readback and package save per item. The region of every item is
+ * saved next to the atlas: as a UQuickBakerAtlasData asset for asset bakes, or as <OutputName>.json for file bakes.
+ */
+class QUICKBAKER_API FQuickBakerAtlas
+{
+public:
+	/** Padding used when none is given: enough for four mips without bleeding between items. */
+	static constexpr int32 DefaultPadding = 4;
+
+	/**
+	 * Packs rectangles into the smallest power-of-two atlas that fits them, growing the shorter side first.
+	 * Uses a bottom-left skyline, placing the tallest rectangles first. Every rectangle keeps Padding pixels free on
+	 * each side, including along the atlas border.
+	 *
+	 * @param Sizes Size of each rectangle, without padding.
+	 * @param Padding Free pixels around each rectangle.
+	 * @param MaxSize Largest width or height of the atlas.
+	 * @param OutAtlasSize Receives the atlas size.
+	 * @param OutPositions Receives the top-left corner of each rectangle, without padding, in the order of Sizes.
+	 * @return False if the rectangles do not fit an atlas of MaxSize.
+	 */
+	static bool Pack(TConstArrayView<FIntPoint> Sizes, int32 Padding, int32 MaxSize, FIntPoint& OutAtlasSize, TArray<FIntPoint>& OutPositions);
+
+	/**
+	 * Bakes items into one atlas and saves it with its region lookup.
+	 * Settings supplies the output: OutputType, BitDepth, Compression, Usage, the asset options, OutputName and
+	 * OutputPath. Width, Height, BakeMode, ResolutionVariants and PostProcessStages are ignored, since variants and
+	 * post-process stages would mix neighbouring items. Each item is drawn with UVs 0-1, and its padding repeats the
+	 * item's edge pixels, drawn at the edge's texture coordinate, so mips and filtering blend with the item's own
+	 * edge rather than its neighbours.
+	 *
+	 * @param Items The items to bake.
+	 * @param Settings The output settings.
+	 * @param Padding Free pixels around each item.
+	 * @param CancellationToken Polled between stages.
+	 * @param OutResultMessage Receives the result message.
+	 * @return True if the atlas and its lookup were saved.
+	 */
+	static bool Execute(TConstArrayView<FQuickBakerAtlasItem> Items, const FQuickBakerSettings& Settings, int32 Padding, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage);
+};
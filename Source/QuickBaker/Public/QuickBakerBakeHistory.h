@@ -0,0 +1,202 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+/**
+ * Performance record of one bake, appended to the bake history.
+ */
+struct QUICKBAKER_API FQuickBakerBakeRecord
+{
+	/** When the bake finished, in UTC. */
+	FDateTime Timestamp;
+
+	/** What ran the bake: "Editor" for the bake button, "Batch" for FQuickBakerBatch jobs, "Atlas" for FQuickBakerAtlas. */
+	FString Source;
+
+	/** Object path of the baked material. */
+	FString Material;
+
+	/** Output name, output type and bake mode of the settings. */
+	FString OutputName;
+	FString OutputType;
+	FString BakeMode;
+
+	/** Size of one cell (the image, a flipbook frame, a cube face or a UDIM tile). */
+	int32 Width = 0;
+	int32 Height = 0;
+
+	/** Pixels rendered over every cell and tile, without resolution variants. */
+	int64 NumPixels = 0;
+
+	/** Number of resolution variants and post-process stages. */
+	int32 NumVariants = 0;
+	int32 NumPostProcessStages = 0;
+
+	/** Whether the bake saved its output. Canceled bakes are not recorded. */
+	bool bSuccess = false;
+
+	/**
+	 * Phase timings in seconds. Setup acquires the render targets, Draw queues the draw and post-process passes, and
+	 * Save waits for the GPU, reads back, encodes and writes. UDIM tiles draw and save in turn, so they only have Save.
+	 * Batch jobs overlap each other and only have Total, from submission to saved.
+	 */
+	double SetupSeconds = 0.0;
+	double DrawSeconds = 0.0;
+	double SaveSeconds = 0.0;
+	double TotalSeconds = 0.0;
+
+	/**
+	 * Growth of the editor's used physical memory from the start of the bake to its highest sample, taken after each
+	 * readback. Buffers kept from earlier bakes, such as the batch ring's, are not counted again.
+	 */
+	int64 HostBytes = 0;
+
+	/** GPU memory of the render targets the bake held: the bake target and its variants. */
+	int64 GPUBytes = 0;
+
+	/** Size on disk of every file or package written, including variants and UDIM tiles. */
+	int64 OutputBytes = 0;
+
+	/** Render targets reused from the pool (hits) and created for the bake (misses). Editor bakes only. */
+	int32 PoolHits = 0;
+	int32 PoolMisses = 0;
+
+	/** True if the asset save was skipped because the pixels matched the existing asset. */
+	bool bSkippedUnchanged = false;
+
+	/**
+	 * Creates a record with the fields taken from the settings filled in.
+	 *
+	 * @param Settings The bake settings.
+	 * @param InSource What ran the bake.
+	 * @return The record, with timings and results still to fill in.
+	 */
+	static FQuickBakerBakeRecord FromSettings(const FQuickBakerSettings& Settings, const FString& InSource);
+
+	/**
+	 * Gets the bake throughput.
+	 *
+	 * @return Rendered megapixels per second of total time, or 0 if no time was recorded.
+	 */
+	double GetMegapixelsPerSecond() const
+	{
+		return TotalSeconds > 0.0 ? NumPixels / (TotalSeconds * 1.0e6) : 0.0;
+	}
+};
+
+/**
+ * Bake history of one material, summarized for trends.
+ */
+struct QUICKBAKER_API FQuickBakerMaterialSummary
+{
+	/** Object path of the material. */
+	FString Material;
+
+	/** Number of successful bakes in the history. */
+	int32 NumBakes = 0;
+
+	/** Median throughput over those bakes in megapixels per second. */
+	double MedianMegapixelsPerSecond = 0.0;
+
+	/** Throughput of the most recent bake. */
+	double LatestMegapixelsPerSecond = 0.0;
+
+	/** Median total time in seconds. */
+	double MedianSeconds = 0.0;
+};
+
+/**
+ * Measures how far the editor's used physical memory rises while one bake runs, from its start to the highest sample
+ * taken by Sample. Scopes may overlap, as batch jobs do, and each sees the samples taken while it is open. Game thread
+ * only.
+ */
+class QUICKBAKER_API FQuickBakerHostMemoryScope
+{
+public:
+	/** Opens the scope at the current used physical memory. */
+	FQuickBakerHostMemoryScope();
+
+	~FQuickBakerHostMemoryScope();
+
+	UE_NONCOPYABLE(FQuickBakerHostMemoryScope);
+
+	/** Samples used physical memory for every open scope. Called where bakes hold the most memory, after a readback. */
+	static void Sample();
+
+	/**
+	 * Gets the growth measured so far.
+	 *
+	 * @return Bytes from the start of the scope to its highest sample, or 0 if memory did not rise.
+	 */
+	int64 GetGrowth() const;
+
+private:
+	uint64 StartBytes = 0;
+	uint64 PeakBytes = 0;
+};
+
+/**
+ * Persistent bake history: one JSON object per line in <Project>/Saved/QuickBaker/BakeHistory.jsonl.
+ * Every editor bake and batch job appends a record, so regressions after a material or pipeline change show up as a
+ * drop in throughput compared to earlier bakes of the same material. The file is plain JSON lines for scripts and
+ * spreadsheets; delete it to start over. All functions must be called from the game thread.
+ */
+class QUICKBAKER_API FQuickBakerBakeHistory
+{
+public:
+	/** Largest number of records Load returns by default, the most recent ones. */
+	static constexpr int32 DefaultMaxRecords = 5000;
+
+	/**
+	 * Gets the history file.
+	 *
+	 * @return The full path of the JSON lines file.
+	 */
+	static FString GetHistoryFilePath();
+
+	/**
+	 * Appends a record to the history file.
+	 *
+	 * @param Record The record to append.
+	 * @return True if the line was written.
+	 */
+	static bool Append(const FQuickBakerBakeRecord& Record);
+
+	/**
+	 * Reads the most recent records. Lines that cannot be parsed are skipped.
+	 *
+	 * @param MaxRecords Largest number of records to return.
+	 * @return The records, oldest first.
+	 */
+	static TArray<FQuickBakerBakeRecord> Load(int32 MaxRecords = DefaultMaxRecords);
+
+	/**
+	 * Gets the size on disk of everything a bake with these settings writes.
+	 *
+	 * @param Settings The bake settings.
+	 * @return Total bytes of the output files or package, its UDIM tiles and resolution variants that exist.
+	 */
+	static int64 GetOutputBytes(const FQuickBakerSettings& Settings);
+
+	/**
+	 * Gets the successful records of one material.
+	 *
+	 * @param Records Records returned by Load.
+	 * @param Material Object path of the material.
+	 * @param MaxRecords Largest number of records to return, the most recent ones.
+	 * @return The records, oldest first.
+	 */
+	static TArray<FQuickBakerBakeRecord> GetMaterialTrend(TConstArrayView<FQuickBakerBakeRecord> Records, const FString& Material, int32 MaxRecords);
+
+	/**
+	 * Gets the materials with the lowest median throughput.
+	 *
+	 * @param Records Records returned by Load.
+	 * @param MaxMaterials Largest number of materials to return.
+	 * @return Summaries of the slowest materials, slowest first.
+	 */
+	static TArray<FQuickBakerMaterialSummary> GetSlowestMaterials(TConstArrayView<FQuickBakerBakeRecord> Records, int32 MaxMaterials);
+};
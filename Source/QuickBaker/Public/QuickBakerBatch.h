@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * Throughput and stage occupancy of a batch.
+ * Stage occupancies are time-weighted averages of the number of jobs in that stage, so with three slots a
+ * GPU-bound batch shows Rendering near 2-3 while an encode-bound one shows Encoding near 2-3.
+ */
+struct QUICKBAKER_API FQuickBakerBatchStats
+{
+	/** Number of jobs in the batch. */
+	int32 NumJobs = 0;
+
+	/** Number of jobs saved successfully. */
+	int32 NumSucceeded = 0;
+
+	/** Number of jobs that failed; canceled jobs are not counted. */
+	int32 NumFailed = 0;
+
+	/** Number of jobs in flight at once, the ring size. */
+	int32 NumSlots = 0;
+
+	/** Wall time of the whole batch in seconds. */
+	double TotalSeconds = 0.0;
+
+	/** Game thread time spent setting up and queuing draws. */
+	double SubmitSeconds = 0.0;
+
+	/** Game thread time spent on saves that read back synchronously (assets, cubemaps, UDIM, variants). */
+	double SyncSaveSeconds = 0.0;
+
+	/** Worker time spent encoding and writing files, summed over all workers. */
+	double EncodeSeconds = 0.0;
+
+	/** Game thread time spent waiting with every slot busy and nothing to hand on. */
+	double StallSeconds = 0.0;
+
+	/** Number of times the game thread had to wait. */
+	int32 NumStalls = 0;
+
+	/** Average number of jobs waiting for the GPU (drawing or reading back). */
+	double AverageRendering = 0.0;
+
+	/** Average number of jobs encoding on workers. */
+	double AverageEncoding = 0.0;
+
+	/** Number of jobs read back synchronously instead of through the ring. */
+	int32 NumSyncReadbacks = 0;
+
+	/**
+	 * Gets the number of jobs finished per second.
+	 *
+	 * @return Jobs per second, or 0 before the batch ran.
+	 */
+	double GetJobsPerSecond() const
+	{
+		return TotalSeconds > 0.0 ? (NumSucceeded + NumFailed) / TotalSeconds : 0.0;
+	}
+
+	/**
+	 * Formats the stats as one log line.
+	 *
+	 * @return The summary text.
+	 */
+	FString ToString() const;
+};
+
+/**
+ * Called on the game thread as each job of a batch finishes, in completion order.
+ * Receives the job index, whether it succeeded, and its time from submission to the end of its save in seconds.
+ */
+using FQuickBakerBatchJobFinished = TFunction<void(int32 JobIndex, bool bSuccess, double Seconds)>;
+
+/**
+ * Bakes many settings in one go with the render, readback and encode stages of consecutive jobs overlapped.
+ * A ring of slots, each with its own render target, staging buffer and pixel buffer, holds the jobs in flight: while
+ * the draw of job N + 1 runs on the GPU, job N is copied to the CPU and job N - 1 is encoded on a worker thread.
+ * File bakes of single images and flipbooks use the full pipeline. Assets, cubemaps, UDIM tiles and resolution
+ * variants still share the ring, but read back synchronously when their turn comes, since their save runs on the
+ * game thread. No dialogs are shown; results are logged.
+ */
+class QUICKBAKER_API FQuickBakerBatch
+{
+public:
+	/** Default number of jobs in flight: one drawing, one reading back, one encoding. */
+	static constexpr int32 DefaultNumSlots = 3;
+
+	/**
+	 * Bakes every job. Must be called from the game thread.
+	 *
+	 * @param Jobs The bake settings, one per output. Invalid jobs fail without stopping the batch.
+	 * @param CancellationToken Stops the batch; jobs already encoding finish or abort through the same token.
+	 * @param OutStats Receives throughput and stage occupancy.
+	 * @param NumSlots Number of jobs in flight, clamped to [1, 4].
+	 * @param OnJobFinished Optional callback per finished job; canceled jobs are not reported.
+	 * @return True if every job succeeded.
+	 */
+	static bool Execute(TConstArrayView<FQuickBakerSettings> Jobs, FQuickBakerCancellationToken& CancellationToken, FQuickBakerBatchStats& OutStats, int32 NumSlots = DefaultNumSlots, const FQuickBakerBatchJobFinished& OnJobFinished = nullptr);
+};
@@ -0,0 +1,65 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FScopedSlowTask;
+
+/**
+ * Cooperative cancellation flag shared by every stage of a bake.
+ * Worker and render threads only read the flag. The game thread additionally polls the bake's progress dialog,
+ * so pressing Cancel is noticed inside long loops instead of only between the coarse bake phases.
+ */
+class QUICKBAKER_API FQuickBakerCancellationToken
+{
+public:
+	/**
+	 * Constructs the token.
+	 *
+	 * @param InSlowTask The progress dialog whose Cancel button is polled, or nullptr for a token that is only canceled by Cancel().
+	 */
+	explicit FQuickBakerCancellationToken(FScopedSlowTask* InSlowTask = nullptr);
+
+	/**
+	 * Requests cancellation. Safe to call from any thread.
+	 */
+	void Cancel();
+
+	/**
+	 * Checks the flag without polling the progress dialog. Safe to call from any thread.
+	 *
+	 * @return True once cancellation was requested.
+	 */
+	bool IsCanceled() const;
+
+	/**
+	 * Checks for cancellation. On the game thread this also polls the progress dialog, at most every few milliseconds.
+	 *
+	 * @return True once cancellation was requested.
+	 */
+	bool ShouldCancel();
+
+	/**
+	 * Runs Body over [0, Num) in parallel, one block at a time, and checks for cancellation between blocks.
+	 * Body receives a [Begin, End) range so per-element work stays free of call overhead.
+	 * Safe to call from any thread, e.g. from encode workers; only calls on the game thread also poll the progress dialog.
+	 *
+	 * @param Num The number of elements.
+	 * @param Body The work for one range of elements.
+	 * @param ElementCost Approximate work per element in pixels (e.g. the width when iterating rows), used to size blocks.
+	 * @return True if every element was processed, false if the loop stopped because of cancellation.
+	 */
+	bool ParallelForRange(int64 Num, TFunctionRef<void(int64 Begin, int64 End)> Body, int64 ElementCost = 1);
+
+private:
+	/** The progress dialog polled on the game thread. */
+	FScopedSlowTask* SlowTask;
+
+	/** Set once cancellation was requested. */
+	std::atomic<bool> bCanceled;
+
+	/** Time of the last progress dialog poll. Only accessed on the game thread. */
+	double LastPollTime;
+};
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "QuickBakerCommandlet.generated.h"
+
+/**
+ * Bakes a job file without the editor UI. Run as UnrealEditor-Cmd <Project> -run=QuickBaker -Jobs=<File> [options],
+ * adding -AllowCommandletRendering so the materials can be drawn (and -RenderOffscreen on machines without a display).
+ *
+ * Modes:
+ *   -Jobs=<File>                           Bake every job in this process.
+ *   -Jobs=<File> -Workers=<N>              Coordinate N worker processes; see FQuickBakerDistributed.
+ *   -Jobs=<File> -Coordinator=<IP:Port>    Run as a worker started by a coordinator, with -Worker=<Id>.
+ *   -Jobs=<File> -Atlas                    Bake every job's material into one atlas; see FQuickBakerAtlas. Each job is
+ *                                          an item of its Width x Height named by its OutputName, and the first job
+ *                                          supplies the output settings.
+ *
+ * Options: -Slots=<N> jobs in flight per process, -Retries=<N> retries of crashed workers' jobs,
+ * -WorkDir=<Dir> shared directory for shards and logs, -Nodes="<Command>;<Command>" launch commands for other nodes,
+ * -Address=<IP> and -Port=<Port> where the coordinator listens, -AtlasName=<Name> name of the atlas output
+ * (T_Atlas by default), -Padding=<N> pixels around each atlas item.
+ * Returns 0 if every job succeeded, 1 otherwise.
+ */
+UCLASS()
+class UQuickBakerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/** Default constructor. */
+	UQuickBakerCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "QuickBakerSettings.h"
+#include "QuickBakerRenderer.h"
+#include "Engine/TextureRenderTarget2D.h"
+
+class UWorld;
+class FQuickBakerCancellationToken;
 
 /**
  * Core logic class for QuickBaker.
@@ -20,13 +25,169 @@ public:
 	static void ExecuteBake(const FQuickBakerSettings& Settings);
 
 private:
+	/** Batches run the same stages, interleaved across several bakes. */
+	friend class FQuickBakerBatch;
+
+	/** Atlases draw and save through the same stages as a single bake. */
+	friend class FQuickBakerAtlas;
+
+	/** The live preview draws through the same stages as a bake, at a lower resolution. */
+	friend class SQuickBakerWidget;
+
+	/**
+	 * Gets the largest texture width or height the GPU supports.
+	 *
+	 * @return The RHI limit, or 16384 before the RHI is initialized.
+	 */
+	static int32 GetMaxTextureDimension();
+
+	/**
+	 * Gets the render target format of a bake: the narrowest fit for assets (see GetAssetFormats), and RGBA8 or
+	 * RGBA16f for files, matching the FColor or FFloat16Color pixels they are read back as.
+	 *
+	 * @param Settings The bake settings.
+	 * @return The render target format.
+	 */
+	static ETextureRenderTargetFormat GetRenderTargetFormat(const FQuickBakerSettings& Settings);
+
+	/**
+	 * Builds the graph passes run after the bake draw: the post-process chain, then a downsample of the finished
+	 * image into each resolution variant target.
+	 *
+	 * @param Settings The bake settings.
+	 * @param VariantTargets One render target per entry of GetResolutionVariantSizes, in the same order.
+	 * @return The passes, or nullptr if there is nothing to add.
+	 */
+	static FQuickBakerGraphPasses MakeBakePasses(const FQuickBakerSettings& Settings, TConstArrayView<UTextureRenderTarget2D*> VariantTargets);
+
+	/**
+	 * Draws every flipbook frame or cubemap face into its grid cell of the render target.
+	 * Each cell uses its own dynamic material instance carrying the frame time or face basis, and all cells are
+	 * submitted in a single render graph through FQuickBakerRenderer, followed by the given passes.
+	 *
+	 * @param World The world context used for drawing.
+	 * @param RenderTarget The render target sized to hold the whole cell grid.
+	 * @param Settings The bake settings containing the bake mode, layout and parameter names.
+	 * @param AfterDraw Passes added to the graph after the cells, such as the post-process chain.
+	 * @return True if all cells were submitted, false otherwise.
+	 */
+	static bool DrawMaterialCells(UWorld* World, UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerGraphPasses AfterDraw);
+
+	/**
+	 * Saves a drawn render target as configured: a texture asset, or a file of the output type.
+	 * Used for the main output and for each resolution variant.
+	 *
+	 * @param RenderTarget The render target holding the image.
+	 * @param Settings The bake settings; OutputName and the size must match the render target.
+	 * @param CancellationToken Polled during readback and encoding.
+	 * @param OutResultMessage Receives the message to show the user.
+	 * @return True if the output was saved.
+	 */
+	static bool SaveRenderTarget(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage);
+
+	/**
+	 * Saves the main output, then each resolution variant, stopping at the first failure.
+	 *
+	 * @param RenderTarget The render target holding the full-size image.
+	 * @param VariantTargets One render target per entry of GetResolutionVariantSizes, in the same order.
+	 * @param Settings The bake settings.
+	 * @param CancellationToken Polled during readback and encoding.
+	 * @param OutResultMessage Receives the message to show the user.
+	 * @return True if every output was saved.
+	 */
+	static bool SaveRenderTargets(UTextureRenderTarget2D* RenderTarget, TConstArrayView<UTextureRenderTarget2D*> VariantTargets, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage);
+
+	/**
+	 * Chooses the render target and texture source formats for an asset bake.
+	 * Compression settings that keep only one or two channels (Grayscale, HalfFloat, SingleFloat, Normalmap)
+	 * use single- or dual-channel render targets to cut GPU memory and readback size.
+	 *
+	 * @param Settings The bake settings containing bit depth and compression.
+	 * @param OutRenderTargetFormat Receives the render target format to draw into.
+	 * @param OutSourceFormat Receives the texture source format to store.
+	 */
+	static void GetAssetFormats(const FQuickBakerSettings& Settings, ETextureRenderTargetFormat& OutRenderTargetFormat, ETextureSourceFormat& OutSourceFormat);
+
+	/**
+	 * Reads the render target and writes its pixels in the given texture source format.
+	 *
+	 * @param RenderTarget The render target to read, in the format chosen by GetAssetFormats.
+	 * @param SourceFormat The texture source format to write.
+	 * @param DstData Destination buffer of SizeX * SizeY pixels in SourceFormat.
+	 * @param CancellationToken Checked between conversion blocks.
+	 * @return True if the pixels were read and converted, false otherwise (including cancellation).
+	 */
+	static bool ReadSourcePixels(UTextureRenderTarget2D* RenderTarget, ETextureSourceFormat SourceFormat, uint8* DstData, FQuickBakerCancellationToken& CancellationToken);
+
+	/**
+	 * Expands two-channel pixels, read in the render target's native format, into a four-channel texture source format,
+	 * reconstructing the normal's Z. Formats whose layout already matches the source need no conversion.
+	 *
+	 * @param RawData The read-back pixels.
+	 * @param PixelFormat The GPU format of RawData.
+	 * @param NumPixels The number of pixels.
+	 * @param SourceFormat The texture source format to write.
+	 * @param DstData Destination buffer of NumPixels pixels in SourceFormat.
+	 * @param CancellationToken Checked between conversion blocks.
+	 * @return True if the pixels were converted, false for unsupported formats or cancellation.
+	 */
+	static bool ConvertSourcePixels(const uint8* RawData, EPixelFormat PixelFormat, int64 NumPixels, ETextureSourceFormat SourceFormat, uint8* DstData, FQuickBakerCancellationToken& CancellationToken);
+
 	/**
 	 * Internal helper to bake the RenderTarget to a static Texture Asset.
 	 *
 	 * @param RenderTarget The temporary render target containing the baked result.
 	 * @param Settings The bake settings containing output path and compression options.
+	 * @param CancellationToken Checked while reading pixels and before saving; a canceled bake saves nothing.
 	 * @param OutResultMessage The result message to display to the user after the progress bar completes.
 	 * @return True if the asset was saved successfully, false otherwise.
 	 */
-	static bool BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FText& OutResultMessage);
+	static bool BakeToAsset(UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage);
+
+	/**
+	 * Bakes every UDIM tile, one at a time, through a single pooled render target.
+	 * Each tile draws the material over its UV range (U + [0, 1], V + [0, 1]), then runs the post-process chain. Files are written as
+	 * <Name>.<Tile>.<ext>, encoded on a worker while the next tile renders, so at most two tiles are held in memory.
+	 * Assets become a multi-block UTexture2D with virtual texture streaming. Each tile is copied back while the next one
+	 * renders, straight into its block of one source buffer that the texture takes over once every tile is read.
+	 *
+	 * @param World The world context used for drawing.
+	 * @param RenderTarget The render target sized to one tile, in the format of the output type.
+	 * @param Settings The bake settings containing the tile grid, output type and path.
+	 * @param CancellationToken Checked between tiles and while reading and writing them.
+	 * @param OutResultMessage The result message to display to the user after the progress bar completes.
+	 * @return True if every tile was saved, false otherwise.
+	 */
+	static bool BakeUDIMTiles(UWorld* World, UTextureRenderTarget2D* RenderTarget, const FQuickBakerSettings& Settings, FQuickBakerCancellationToken& CancellationToken, FText& OutResultMessage);
+
+	/**
+	 * Gets the long package name of an asset bake: OutputPath under /Game/, without trailing slashes, plus OutputName.
+	 *
+	 * @param Settings The bake settings containing output path and name.
+	 * @return The long package name, e.g. /Game/Textures/T_Noise.
+	 */
+	static FString GetAssetPackageName(const FQuickBakerSettings& Settings);
+
+	/**
+	 * Finds the texture asset at the output path, or creates its package and a new texture object.
+	 *
+	 * @param Settings The bake settings containing output path and name.
+	 * @param TextureClass The texture class the asset must have.
+	 * @param OutFullPackageName Receives the long package name.
+	 * @param bOutIsNewTexture Receives true if the texture was created rather than found.
+	 * @param OutResultMessage Receives the error message on failure.
+	 * @return The texture, or nullptr on failure.
+	 */
+	static UTexture* FindOrCreateTextureAsset(const FQuickBakerSettings& Settings, UClass* TextureClass, FString& OutFullPackageName, bool& bOutIsNewTexture, FText& OutResultMessage);
+
+	/**
+	 * Marks a baked texture's package dirty, saves it and queues the texture's platform data update.
+	 *
+	 * @param Texture The texture whose source was just written.
+	 * @param FullPackageName The long package name of the texture.
+	 * @param bIsNewTexture True if the texture was created by this bake.
+	 * @param OutResultMessage Receives the result message.
+	 * @return True if the package was saved.
+	 */
+	static bool SaveTextureAsset(UTexture* Texture, const FString& FullPackageName, bool bIsNewTexture, FText& OutResultMessage);
 };
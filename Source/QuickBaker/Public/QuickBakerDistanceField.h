@@ -0,0 +1,32 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * CPU signed distance field generation for pixels already on the CPU, with the same result as the GPU SignedDistance
+ * post-process stage.
+ * Uses an exact separable Euclidean distance transform (Felzenszwalb-Huttenlocher), run in parallel over columns and
+ * then rows, so a 4k mask takes well under a second.
+ */
+class QUICKBAKER_API FQuickBakerDistanceField
+{
+public:
+	/**
+	 * Replaces a mask with its signed distance field, using the same encoding as the GPU stage:
+	 * the distance to the mask edge divided by Spread and clamped to [-1, 1], positive inside the mask.
+	 *
+	 * @param Mask The mask values, one per pixel, row by row.
+	 * @param Width The image width in pixels.
+	 * @param Height The image height in pixels.
+	 * @param Threshold Mask value above which a pixel is inside.
+	 * @param Spread Distance in pixels mapped to 1.
+	 * @param OutDistance Receives Width * Height distances. May be the same buffer as Mask.
+	 * @param CancellationToken Checked between blocks of rows and columns.
+	 * @return True if the field was generated, false on invalid input or cancellation.
+	 */
+	static bool Generate(const float* Mask, int32 Width, int32 Height, float Threshold, float Spread, float* OutDistance, FQuickBakerCancellationToken& CancellationToken);
+};
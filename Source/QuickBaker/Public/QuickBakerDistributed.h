@@ -0,0 +1,125 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerBatch.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * Options of a distributed batch.
+ */
+struct QUICKBAKER_API FQuickBakerDistributedOptions
+{
+	/** Number of worker processes running at once. */
+	int32 NumWorkers = 4;
+
+	/** Number of times the unfinished jobs of a crashed worker are handed to a new worker before they fail. */
+	int32 MaxRetries = 2;
+
+	/**
+	 * Seconds a worker may go without reporting a job, counted from its start or its last report, before it is
+	 * terminated and its unreported jobs are retried like those of a crashed worker. 0 to wait forever.
+	 */
+	double WorkerTimeoutSeconds = 1800.0;
+
+	/** Jobs in flight inside each worker, passed to FQuickBakerBatch. */
+	int32 NumSlotsPerWorker = FQuickBakerBatch::DefaultNumSlots;
+
+	/**
+	 * Directory for shard files and worker logs. Must be visible to every node at the same path.
+	 * Empty for <Project>/Saved/QuickBaker/Distributed.
+	 */
+	FString WorkDirectory;
+
+	/**
+	 * Commands that start a worker on another node, e.g. "ssh render02". Workers are spread over the entries in turn;
+	 * the editor, project and arguments are appended to the command. Empty to run every worker on this machine.
+	 * The editor and project must be at the same paths on every node.
+	 */
+	TArray<FString> NodeLaunchCommands;
+
+	/**
+	 * IPv4 address workers on other nodes use to reach the coordinator. Use an address of this machine that the nodes
+	 * can reach. Without NodeLaunchCommands the coordinator only listens on, and workers connect through, 127.0.0.1.
+	 */
+	FString CoordinatorAddress = TEXT("127.0.0.1");
+
+	/** TCP port the coordinator listens on, or 0 for any free port. */
+	int32 Port = 0;
+};
+
+/**
+ * Results of a distributed batch.
+ */
+struct QUICKBAKER_API FQuickBakerDistributedStats
+{
+	/** Number of jobs in the batch. */
+	int32 NumJobs = 0;
+
+	/** Number of jobs saved successfully. */
+	int32 NumSucceeded = 0;
+
+	/** Number of jobs that failed, including jobs that ran out of retries. */
+	int32 NumFailed = 0;
+
+	/** Number of worker processes started, including replacements. */
+	int32 NumWorkersLaunched = 0;
+
+	/** Number of workers that exited before reporting all of their jobs. */
+	int32 NumWorkerCrashes = 0;
+
+	/** Number of workers terminated after WorkerTimeoutSeconds without a report. */
+	int32 NumWorkerTimeouts = 0;
+
+	/** Number of jobs handed to a replacement worker. */
+	int32 NumRetriedJobs = 0;
+
+	/** Wall time of the whole batch in seconds. */
+	double TotalSeconds = 0.0;
+
+	/**
+	 * Formats the stats as one log line.
+	 *
+	 * @return The summary text.
+	 */
+	FString ToString() const;
+};
+
+/**
+ * Bakes a batch across several headless editor processes, on this machine or on nodes sharing a filesystem.
+ * The coordinator splits the jobs into shards, writes each shard as a job file and starts one worker per shard
+ * through the QuickBaker commandlet. Each worker bakes its shard with FQuickBakerBatch and reports every finished job
+ * as one JSON line over a TCP connection to the coordinator, carrying a random per-batch token from its shard; lines
+ * without it are dropped. When a worker exits before reporting all of its jobs,
+ * the rest are written to a new shard for a replacement worker, up to MaxRetries times. A worker that reports nothing
+ * for WorkerTimeoutSeconds is terminated and handled the same way. Jobs a worker reports as failed are not retried,
+ * since the same settings would fail again.
+ */
+class QUICKBAKER_API FQuickBakerDistributed
+{
+public:
+	/**
+	 * Bakes every job in worker processes. Must be called from the game thread.
+	 *
+	 * @param Jobs The bake settings. Outputs must be paths every worker can write to.
+	 * @param Options Worker count, retries and where the workers run.
+	 * @param CancellationToken Stops the batch; running workers are terminated.
+	 * @param OutStats Receives the results.
+	 * @param OnJobFinished Optional callback per finished job with the time the worker took for it.
+	 * @return True if every job succeeded.
+	 */
+	static bool Execute(TConstArrayView<FQuickBakerSettings> Jobs, const FQuickBakerDistributedOptions& Options, FQuickBakerCancellationToken& CancellationToken, FQuickBakerDistributedStats& OutStats, const FQuickBakerBatchJobFinished& OnJobFinished = nullptr);
+
+	/**
+	 * Runs one worker: bakes a shard and reports each job to the coordinator. Called by the commandlet.
+	 *
+	 * @param JobFilePath The shard written by the coordinator.
+	 * @param CoordinatorAddress The coordinator as <IPv4>:<Port>.
+	 * @param WorkerId The id sent back with every result.
+	 * @param NumSlots Jobs in flight, passed to FQuickBakerBatch.
+	 * @return True if every job of the shard succeeded.
+	 */
+	static bool RunWorker(const FString& JobFilePath, const FString& CoordinatorAddress, int32 WorkerId, int32 NumSlots);
+};
@@ -18,9 +18,13 @@ class QUICKBAKER_API UQuickBakerEditorSettings : public UObject
 	GENERATED_BODY()
 
 public:
-	/** Last used resolution (width and height) */
+	/** Last used output width */
 	UPROPERTY(Config)
-	int32 LastUsedResolution = 1024;
+	int32 LastUsedWidth = 1024;
+
+	/** Last used output height */
+	UPROPERTY(Config)
+	int32 LastUsedHeight = 1024;
 
 	/** Last used output path (Content Browser path or disk path) */
 	UPROPERTY(Config)
@@ -34,7 +38,19 @@ public:
 	UPROPERTY(Config)
 	uint8 LastUsedOutputType = static_cast<uint8>(EQuickBakerOutputType::Asset);
 
+	/** Last used bake mode */
+	UPROPERTY(Config)
+	uint8 LastUsedBakeMode = static_cast<uint8>(EQuickBakerBakeMode::Single);
+
 	/** Last used texture compression */
 	UPROPERTY(Config)
 	uint8 LastUsedCompression = static_cast<uint8>(TC_Default);
+
+	/** Last used texture usage */
+	UPROPERTY(Config)
+	uint8 LastUsedUsage = static_cast<uint8>(EQuickBakerTextureUsage::Auto);
+
+	/** Last used source compression toggle */
+	UPROPERTY(Config)
+	bool bLastUsedCompressSource = false;
 };
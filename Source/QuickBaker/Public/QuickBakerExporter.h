@@ -5,22 +5,54 @@
 #include "CoreMinimal.h"
 #include "Logging/LogMacros.h"
 #include "Engine/TextureRenderTarget2D.h"
+#include "QuickBakerSettings.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogQuickBaker, Log, All);
 
+class FQuickBakerCancellationToken;
+
 /**
- * Helper class for exporting Render Targets to external files (PNG, EXR).
+ * Helper class for exporting Render Targets to external files.
+ * PNG and EXR go through the engine image wrappers; the fast formats are written by FQuickBakerFastFormats.
  */
 class QUICKBAKER_API FQuickBakerExporter
 {
 public:
 	/**
-	 * Exports the content of a RenderTarget to a file on disk (PNG or EXR).
+	 * Exports the content of a RenderTarget to a file on disk.
+	 *
+	 * @param RenderTarget The source Render Target to read pixels from: RTF_RGBA8 for 8-bit formats, RTF_RGBA16f for float.
+	 * @param FullPath The full file system path where the file should be saved, including the extension.
+	 * @param OutputType The file format to write.
+	 * @param CancellationToken Optional token checked between stages and while writing; a canceled export leaves no partial file.
+	 * @return True if the file was successfully saved, false otherwise.
+	 */
+	static bool ExportToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Exports a cubemap render target as an equirectangular (long-lat) image.
+	 * The render target must hold the six faces laid out 3x2 in face order (+X, -X, +Y, -Y, +Z, -Z).
+	 * The exported image is 4x the face size wide and 2x the face size high.
+	 *
+	 * @param RenderTarget The source Render Target holding the cube faces: RTF_RGBA8 for 8-bit formats, RTF_RGBA16f for float.
+	 * @param FullPath The full file system path where the file should be saved, including the extension.
+	 * @param OutputType The file format to write.
+	 * @param CancellationToken Optional token checked between stages and while writing; a canceled export leaves no partial file.
+	 * @return True if the file was successfully saved, false otherwise.
+	 */
+	static bool ExportCubemapToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Encodes CPU pixel data and writes it to a file on disk.
 	 *
-	 * @param RenderTarget The source Render Target to read pixels from.
+	 * @param Pixels The pixel data: FColor (BGRA) if bIsFloat is false, FFloat16Color (RGBA) otherwise.
+	 * @param Width The image width in pixels.
+	 * @param Height The image height in pixels.
+	 * @param bIsFloat True if Pixels holds FFloat16Color. PNG, QOI and TGA need 8-bit pixels and EXR needs float.
 	 * @param FullPath The full file system path where the file should be saved, including the extension.
-	 * @param bIsPNG Set to true to export as PNG (8-bit, BGRA). Set to false to export as EXR (16-bit float, RGBA).
+	 * @param OutputType The file format to write.
+	 * @param CancellationToken Optional token checked between stages and while writing; a canceled export leaves no partial file.
 	 * @return True if the file was successfully saved, false otherwise.
 	 */
-	static bool ExportToFile(UTextureRenderTarget2D* RenderTarget, const FString& FullPath, bool bIsPNG);
+	static bool ExportPixelsToFile(const void* Pixels, int32 Width, int32 Height, bool bIsFloat, const FString& FullPath, EQuickBakerOutputType OutputType, FQuickBakerCancellationToken* CancellationToken = nullptr);
 };
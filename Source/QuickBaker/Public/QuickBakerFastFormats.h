@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+class FQuickBakerCancellationToken;
+
+/**
+ * Writers for export formats that trade file size for speed: QOI, uncompressed TGA and DDS, and NumPy/raw dumps.
+ * Pixels are streamed through FQuickBakerFileWriter. Layouts that already match the pixel memory are written
+ * straight from the buffer; the others are converted in parallel, one staging chunk at a time.
+ */
+class QUICKBAKER_API FQuickBakerFastFormats
+{
+public:
+	/**
+	 * Gets whether an output type is written by this class rather than the engine image wrappers.
+	 *
+	 * @param Type The output type.
+	 * @return True for QOI, TGA, DDS, NPY and RAW.
+	 */
+	static bool IsFastFormat(EQuickBakerOutputType Type);
+
+	/**
+	 * Writes pixels to a file in one of the fast formats.
+	 *
+	 * @param Pixels The pixel data: FColor (BGRA) if bIsFloat is false, FFloat16Color (RGBA) otherwise.
+	 * @param Width The image width in pixels.
+	 * @param Height The image height in pixels.
+	 * @param bIsFloat True if Pixels holds FFloat16Color. QOI and TGA require 8-bit pixels.
+	 * @param Type The output format.
+	 * @param FullPath The full file system path, including the extension.
+	 * @param CancellationToken Checked between chunks; a canceled write leaves no partial file.
+	 * @return True if the file was written, false otherwise.
+	 */
+	static bool WriteFile(const void* Pixels, int32 Width, int32 Height, bool bIsFloat, EQuickBakerOutputType Type, const FString& FullPath, FQuickBakerCancellationToken& CancellationToken);
+};
@@ -0,0 +1,83 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+class FQuickBakerCancellationToken;
+
+/**
+ * Streams export data straight from the encoder's buffer to disk.
+ * Data goes through an unbuffered platform file handle in large chunks. The file is pre-sized when the final size
+ * is known, and is written to a temporary file that only replaces the destination on Commit(). A failed or canceled
+ * export therefore never leaves a truncated image behind or clobbers the previous file.
+ */
+class QUICKBAKER_API FQuickBakerFileWriter
+{
+public:
+	/**
+	 * Constructs a writer for the given destination. Nothing is opened until Open().
+	 *
+	 * @param InFullPath The final file system path, including the extension.
+	 */
+	explicit FQuickBakerFileWriter(const FString& InFullPath);
+
+	/** Discards the temporary file if Commit() was never reached. */
+	~FQuickBakerFileWriter();
+
+	/**
+	 * Opens the temporary file, creating the destination directory if needed.
+	 *
+	 * @param ExpectedSize The final file size if known, used to pre-size the file; 0 lets it grow chunk by chunk.
+	 * @return True if the file was opened, false otherwise.
+	 */
+	bool Open(int64 ExpectedSize = 0);
+
+	/**
+	 * Appends data, checking for cancellation between chunks.
+	 *
+	 * @param Data The bytes to write.
+	 * @param NumBytes The number of bytes to write.
+	 * @param CancellationToken Optional token checked between chunks.
+	 * @return True if every byte was written, false on I/O failure or cancellation.
+	 */
+	bool Write(const void* Data, int64 NumBytes, FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Closes the file and moves it over the destination. A previous file is first renamed to <Path>.bak and deleted
+	 * once the move succeeded; if the move fails it is restored, so the destination never ends up empty.
+	 *
+	 * @return True if the destination now holds the written data, false otherwise.
+	 */
+	bool Commit();
+
+	/**
+	 * Closes and deletes the temporary file, leaving the destination untouched.
+	 */
+	void Discard();
+
+	/**
+	 * Writes a whole buffer to FullPath with the steps above.
+	 *
+	 * @param FullPath The final file system path, including the extension.
+	 * @param Data The bytes to write.
+	 * @param NumBytes The number of bytes to write.
+	 * @param CancellationToken Optional token checked between chunks.
+	 * @return True if the file was written and committed, false otherwise.
+	 */
+	static bool WriteFile(const FString& FullPath, const void* Data, int64 NumBytes, FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+private:
+	/** Final destination path. */
+	FString FullPath;
+
+	/** Temporary path the data is written to before Commit(). */
+	FString TempPath;
+
+	/** Open handle to TempPath, or null when closed. */
+	TUniquePtr<IFileHandle> Handle;
+
+	/** Bytes written so far; the file is truncated to this on Commit() if it was pre-sized larger. */
+	int64 BytesWritten;
+};
@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FImage;
+struct FImageView;
+
+/**
+ * Differences between two images of the same size.
+ * Errors are per channel over RGBA, in 0-1 units for 8-bit images and in value units for float images.
+ */
+struct QUICKBAKER_API FQuickBakerImageDiffResult
+{
+	/** Largest absolute difference of any channel of any pixel. */
+	float MaxError = 0.0f;
+
+	/** Pixel holding MaxError, or (-1, -1) for identical images. */
+	FIntPoint MaxErrorPixel = FIntPoint(-1, -1);
+
+	/** Mean of the squared channel differences. */
+	double MeanSquaredError = 0.0;
+
+	/** Peak signal-to-noise ratio in dB for a peak value of 1. Infinite for identical images. */
+	double PSNR = 0.0;
+
+	/** Number of pixels with a channel difference above the threshold passed to Compare. */
+	int64 NumDifferentPixels = 0;
+
+	/**
+	 * Formats the result as one log line.
+	 *
+	 * @return The summary text.
+	 */
+	FString ToString() const;
+};
+
+/**
+ * Fast comparison of baked images, used by the golden-image tests.
+ * Rows are split across worker threads and each pixel is compared as one four-channel vector, so hundreds of
+ * comparisons per run stay cheap. 8-bit BGRA and 32-bit float RGBA images are read in place; other formats are
+ * converted to float RGBA once. No memory is allocated per row or pixel.
+ */
+class QUICKBAKER_API FQuickBakerImageDiff
+{
+public:
+	/**
+	 * Compares two images.
+	 *
+	 * @param A The first image, e.g. the golden.
+	 * @param B The second image, e.g. the new output.
+	 * @param OutResult Receives the differences.
+	 * @param PixelThreshold Channel difference above which a pixel counts in NumDifferentPixels.
+	 * @return False if the images differ in size or either is empty.
+	 */
+	static bool Compare(const FImageView& A, const FImageView& B, FQuickBakerImageDiffResult& OutResult, float PixelThreshold = 0.0f);
+
+	/**
+	 * Builds a heatmap of the per-pixel error: black where the images match, through red and yellow to white at
+	 * FullScaleError or above.
+	 *
+	 * @param A The first image.
+	 * @param B The second image, of the same size.
+	 * @param FullScaleError Error shown as white.
+	 * @param OutHeatmap Receives an 8-bit BGRA image of the same size.
+	 * @return False if the images differ in size or either is empty.
+	 */
+	static bool MakeHeatmap(const FImageView& A, const FImageView& B, float FullScaleError, FImage& OutHeatmap);
+};
@@ -0,0 +1,79 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+class FJsonObject;
+
+/**
+ * Reads and writes bake settings as JSON, so jobs can be handed to other processes or kept next to a project.
+ * A job file holds { "Version": 1, "Jobs": [ { "Id": 0, "Settings": { ... } }, ... ] }, and shards written by a
+ * distributed batch also hold the batch's "Token". Enums are stored by name
+ * and the material by its object path; fields missing from a file keep their default values.
+ */
+class QUICKBAKER_API FQuickBakerJobFile
+{
+public:
+	/** Version written to new files. Files from a newer version are rejected. */
+	static constexpr int32 Version = 1;
+
+	/**
+	 * Gets the name an output type is stored under, e.g. "PNG".
+	 *
+	 * @param Type The output type.
+	 * @return The name.
+	 */
+	static const TCHAR* GetOutputTypeName(EQuickBakerOutputType Type);
+
+	/**
+	 * Gets the name a bake mode is stored under, e.g. "Flipbook".
+	 *
+	 * @param Mode The bake mode.
+	 * @return The name.
+	 */
+	static const TCHAR* GetBakeModeName(EQuickBakerBakeMode Mode);
+
+	/**
+	 * Converts settings to a JSON object.
+	 *
+	 * @param Settings The settings to convert.
+	 * @return The JSON object.
+	 */
+	static TSharedRef<FJsonObject> ToJson(const FQuickBakerSettings& Settings);
+
+	/**
+	 * Reads settings from a JSON object and loads the material it refers to.
+	 * The settings only hold a weak pointer to the material; the caller keeps it alive.
+	 *
+	 * @param Object The JSON object written by ToJson.
+	 * @param OutSettings Receives the settings.
+	 * @param OutError Receives the reason on failure.
+	 * @return True if the object was read and its material loaded.
+	 */
+	static bool FromJson(const FJsonObject& Object, FQuickBakerSettings& OutSettings, FString& OutError);
+
+	/**
+	 * Writes jobs to a file.
+	 *
+	 * @param FilePath The file to write.
+	 * @param Jobs The settings of each job.
+	 * @param JobIds An id per job, kept when a batch is split into shards. Empty to number the jobs from 0.
+	 * @param Token Secret a worker sends back with its results. Empty to write none.
+	 * @return True if the file was written.
+	 */
+	static bool Save(const FString& FilePath, TConstArrayView<FQuickBakerSettings> Jobs, TConstArrayView<int32> JobIds = TConstArrayView<int32>(), const FString& Token = FString());
+
+	/**
+	 * Reads jobs from a file. A job whose material cannot be loaded is still returned, without a material, so that
+	 * it fails on its own and the ids stay in step.
+	 *
+	 * @param FilePath The file to read.
+	 * @param OutJobs Receives the settings of each job.
+	 * @param OutJobIds Receives the id of each job. Optional.
+	 * @param OutToken Receives the token, or an empty string if the file has none. Optional.
+	 * @return True if the file was read.
+	 */
+	static bool Load(const FString& FilePath, TArray<FQuickBakerSettings>& OutJobs, TArray<int32>* OutJobIds = nullptr, FString* OutToken = nullptr);
+};
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickBakerSettings.h"
+
+class UTexture;
+
+/**
+ * Projected runtime memory of a baked texture on one target platform.
+ */
+struct QUICKBAKER_API FQuickBakerPlatformMemory
+{
+	/** Target platform name, e.g. "Windows". */
+	FString PlatformName;
+
+	/** Texture format the platform compresses to, e.g. "DXT5". */
+	FName TextureFormat;
+
+	/** Size of the largest mip loaded in game, after the texture group, size limit and mip bias. */
+	FIntPoint ResidentSize = FIntPoint::ZeroValue;
+
+	/** Number of mips loaded in game. */
+	int32 NumMips = 0;
+
+	/** Memory of the loaded mips of every face or tile. */
+	int64 Bytes = 0;
+
+	/** Whether the texture is paged through the virtual texture pool rather than the texture pool. */
+	bool bVirtual = false;
+
+	/** Whether the format is not known to the estimate, which then assumes 32 bits per pixel. */
+	bool bUnknownFormat = false;
+
+	/** Whether Bytes is above the budget of the rule applied to the texture. */
+	bool bOverBudget = false;
+};
+
+/**
+ * Applies the project's output rules (UQuickBakerProjectSettings) to baked texture assets, so they arrive with the
+ * texture group, size limit, mip bias and streaming choices the game's memory budget expects, and projects the
+ * memory each target platform will spend on them.
+ */
+class QUICKBAKER_API FQuickBakerOutputProfile
+{
+public:
+	/**
+	 * Gets the usage of a bake. Auto becomes Effects for flipbooks, Normal for normal maps, Mask for grayscale and
+	 * alpha, Data for float compression and Color otherwise.
+	 *
+	 * @param Settings The bake settings.
+	 * @return The usage, never Auto.
+	 */
+	static EQuickBakerTextureUsage ResolveUsage(const FQuickBakerSettings& Settings);
+
+	/**
+	 * Finds the first output rule matching a bake.
+	 *
+	 * @param Settings The bake settings.
+	 * @param Size Size of the texture source, per face for cubemaps and per tile for UDIMs.
+	 * @param OutRule Receives the rule.
+	 * @return False if no rule matches.
+	 */
+	static bool FindRule(const FQuickBakerSettings& Settings, const FIntPoint& Size, FQuickBakerOutputRule& OutRule);
+
+	/**
+	 * Sets the texture properties of a rule. Without a rule only mips are turned off and the other properties are left
+	 * as they are.
+	 *
+	 * @param Rule The rule, or nullptr.
+	 * @param Texture The texture to change.
+	 */
+	static void Apply(const FQuickBakerOutputRule* Rule, UTexture* Texture);
+
+	/**
+	 * Gets whether a texture already has the properties Apply would set.
+	 *
+	 * @param Rule The rule, or nullptr.
+	 * @param Texture The texture.
+	 * @return True if Apply would change nothing.
+	 */
+	static bool IsApplied(const FQuickBakerOutputRule* Rule, const UTexture* Texture);
+
+	/**
+	 * Projects the runtime memory of a texture on each platform of UQuickBakerProjectSettings::ReportPlatforms, from the
+	 * platform's texture format and texture group settings. Block-compressed formats of unknown block size (ASTC) are
+	 * counted at 8 bits per pixel, an upper bound.
+	 *
+	 * @param Texture The texture, with its source and properties set.
+	 * @param Size Size of the texture source, per face for cubemaps and per tile for UDIMs.
+	 * @param NumSlices Number of faces or tiles.
+	 * @param BudgetBytes Budget to flag against, or 0.
+	 * @return One entry per installed platform.
+	 */
+	static TArray<FQuickBakerPlatformMemory> ProjectRuntimeMemory(const UTexture* Texture, const FIntPoint& Size, int32 NumSlices, int64 BudgetBytes);
+
+	/**
+	 * Formats a projection as lines of "<Platform>: <Format> <Size>, <Mips> mips, <Memory>".
+	 *
+	 * @param Memory The projection.
+	 * @return The report, or an empty string if Memory is empty.
+	 */
+	static FString FormatMemoryReport(TConstArrayView<FQuickBakerPlatformMemory> Memory);
+};
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Engine/TextureDefines.h" // For TextureGroup, TextureMipGenSettings
+#include "QuickBakerProjectSettings.generated.h"
+
+/**
+ * What a baked texture is used for at runtime. Output rules are chosen by usage and size.
+ */
+UENUM()
+enum class EQuickBakerTextureUsage : uint8
+{
+	Auto,    /**< Derived from the bake: flipbooks are Effects, otherwise by compression setting */
+	Color,   /**< Base color and other color maps */
+	Normal,  /**< Normal maps */
+	Mask,    /**< Grayscale, alpha and packed masks */
+	Data,    /**< Float data sampled exactly, e.g. distance fields and lookup tables */
+	UI,      /**< Widgets and other screen-space textures */
+	Effects  /**< Particle and flipbook textures */
+};
+
+/**
+ * Texture settings applied to baked assets of one usage and size range.
+ */
+USTRUCT()
+struct QUICKBAKER_API FQuickBakerOutputRule
+{
+	GENERATED_BODY()
+
+	/** Name shown in the log and the result message. */
+	UPROPERTY(EditAnywhere, Config, Category = "Match")
+	FString Name;
+
+	/** Usages the rule applies to. Empty for any usage. */
+	UPROPERTY(EditAnywhere, Config, Category = "Match")
+	TArray<EQuickBakerTextureUsage> Usages;
+
+	/** Smallest width or height of the baked texture (per face or tile) the rule applies to. */
+	UPROPERTY(EditAnywhere, Config, Category = "Match", meta = (ClampMin = "0"))
+	int32 MinSize = 0;
+
+	/** Largest width or height the rule applies to. 0 for no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Match", meta = (ClampMin = "0"))
+	int32 MaxSize = 0;
+
+	/** Texture group, which sets the per-platform size limits and filtering. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture")
+	TEnumAsByte<TextureGroup> LODGroup = TEXTUREGROUP_World;
+
+	/** Mip generation. Mip bias and streaming only take effect on textures with mips. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture")
+	TEnumAsByte<TextureMipGenSettings> MipGenSettings = TMGS_FromTextureGroup;
+
+	/** Largest size loaded in game. 0 for no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture", meta = (ClampMin = "0"))
+	int32 MaxTextureSize = 0;
+
+	/** Number of top mips dropped in game. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture", meta = (ClampMin = "0"))
+	int32 LODBias = 0;
+
+	/** Streams the texture through the virtual texture pool instead of the texture pool. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture")
+	bool bVirtualTextureStreaming = false;
+
+	/** Keeps every mip resident instead of streaming them. */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture")
+	bool bNeverStream = false;
+
+	/** Runtime memory per texture above which the report warns, on any platform. 0 for no budget. */
+	UPROPERTY(EditAnywhere, Config, Category = "Budget", meta = (ClampMin = "0"))
+	int32 MaxMemoryKB = 0;
+};
+
+/**
+ * Project-wide QuickBaker settings, shared by everyone working on the project.
+ * Stored in: Config/DefaultEditor.ini, edited under Project Settings > Plugins > QuickBaker.
+ */
+UCLASS(config=Editor, defaultconfig)
+class QUICKBAKER_API UQuickBakerProjectSettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UQuickBakerProjectSettings();
+
+	/**
+	 * Rules applied to baked texture assets. The first rule matching the usage and size of a bake sets its texture
+	 * group, mips, size limit, mip bias and streaming. Without a match only mips are turned off, as before rules.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Output Rules")
+	TArray<FQuickBakerOutputRule> OutputRules;
+
+	/** Target platforms the projected runtime memory is reported for. Platforms whose SDK is not installed are skipped. */
+	UPROPERTY(EditAnywhere, Config, Category = "Output Rules")
+	TArray<FString> ReportPlatforms;
+};
@@ -0,0 +1,143 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "QuickBakerRenderer.h"
+#include <atomic>
+
+class FQuickBakerCancellationToken;
+class FRHIGPUTextureReadback;
+
+/**
+ * Helper class for reading render target pixels back to the CPU in their native GPU format.
+ * Unlike FRenderTarget::ReadPixels, no per-pixel format conversion is applied, so single- and dual-channel
+ * targets are read at their actual size.
+ */
+class QUICKBAKER_API FQuickBakerReadback
+{
+public:
+	/**
+	 * Copies the render target into tightly packed rows of its native pixel format.
+	 * The GPU row pitch is removed, so the result holds exactly SizeX * SizeY pixels.
+	 * Draws queued earlier on the render thread are complete before the copy, since this flushes rendering commands.
+	 *
+	 * @param RenderTarget The render target to read.
+	 * @param OutData Receives SizeX * SizeY * BytesPerPixel bytes.
+	 * @param OutFormat Receives the pixel format of the data.
+	 * @param CancellationToken Optional token; a canceled bake skips the staging copy once the GPU copy completes.
+	 * @return True if the pixels were read successfully, false otherwise.
+	 */
+	static bool ReadRawPixels(UTextureRenderTarget2D* RenderTarget, TArray64<uint8>& OutData, EPixelFormat& OutFormat, const FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Copies the render target into a caller-provided buffer, in tightly packed rows of its native pixel format.
+	 *
+	 * @param RenderTarget The render target to read.
+	 * @param DstData Destination buffer of SizeX * SizeY * BytesPerPixel bytes.
+	 * @param OutFormat Receives the pixel format of the data.
+	 * @param CancellationToken Optional token; a canceled bake skips the staging copy once the GPU copy completes.
+	 * @return True if the pixels were read successfully, false otherwise.
+	 */
+	static bool ReadRawPixels(UTextureRenderTarget2D* RenderTarget, uint8* DstData, EPixelFormat& OutFormat, const FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Reads an RTF_RGBA8 or RTF_RGBA16f render target as FColor (BGRA) or FFloat16Color (RGBA) pixels.
+	 * Staging rows are copied as-is, without the per-pixel decode of FRenderTarget::ReadPixels;
+	 * red and blue are swapped only if the GPU stores the channels in the other order.
+	 *
+	 * @param RenderTarget The render target to read.
+	 * @param DstData Destination buffer of SizeX * SizeY FColor or FFloat16Color pixels.
+	 * @param CancellationToken Optional token; a canceled bake skips the staging copy once the GPU copy completes.
+	 * @return True if the pixels were read successfully, false otherwise (including other render target formats).
+	 */
+	static bool ReadColorPixels(UTextureRenderTarget2D* RenderTarget, uint8* DstData, const FQuickBakerCancellationToken* CancellationToken = nullptr);
+
+	/**
+	 * Turns raw RGBA8 or RGBA16f pixels, as read back in the GPU's native format, into FColor or FFloat16Color pixels.
+	 *
+	 * @param Data The pixels, converted in place.
+	 * @param NumPixels The number of pixels.
+	 * @param PixelFormat The GPU format the pixels were read in.
+	 * @return True if the pixels are now FColor or FFloat16Color, false for other formats.
+	 */
+	static bool ConvertToColorPixels(uint8* Data, int64 NumPixels, EPixelFormat PixelFormat);
+};
+
+/**
+ * A render target readback that never blocks the game thread.
+ * The GPU copy joins the render graph that draws the target, and the pixels are collected once the GPU has passed it,
+ * so several bakes can be in flight at once. Reusing one object keeps its staging buffer allocated between bakes.
+ * Must be used from the game thread, and stay alive until its queued rendering commands have run (the destructor
+ * flushes them if needed).
+ */
+class QUICKBAKER_API FQuickBakerAsyncReadback
+{
+public:
+	FQuickBakerAsyncReadback();
+	~FQuickBakerAsyncReadback();
+
+	/**
+	 * Starts a readback. Nothing is queued yet: the returned passes add the copy to the graph drawing the target.
+	 *
+	 * @param Size The size of the render target.
+	 * @param BytesPerPixel The size of a pixel in the render target's format.
+	 * @param DstData Receives Size.X * Size.Y tightly packed pixels in the GPU's native format. Must stay valid until
+	 *                the readback completes or fails.
+	 * @return Passes to run after the draw, e.g. as FQuickBakerRenderer's AfterDraw.
+	 */
+	FQuickBakerGraphPasses Begin(const FIntPoint& Size, int32 BytesPerPixel, uint8* DstData);
+
+	/**
+	 * Checks whether the pixels have arrived. While the GPU is still busy this queues another check.
+	 *
+	 * @return True once DstData holds the pixels.
+	 */
+	bool Poll();
+
+	/**
+	 * Returns to idle after Begin when the passes were never added to a graph, e.g. because the draw failed.
+	 */
+	void Reset();
+
+	/**
+	 * Gets whether the readback failed; Poll will never succeed.
+	 *
+	 * @return True if the copy could not be made or mapped.
+	 */
+	bool HasFailed() const;
+
+	/**
+	 * Gets the GPU format the pixels were read in. Valid once Poll returned true.
+	 *
+	 * @return The pixel format, e.g. for ConvertToColorPixels.
+	 */
+	EPixelFormat GetPixelFormat() const;
+
+private:
+	enum class EState : uint8
+	{
+		Idle,
+		Pending,
+		Complete,
+		Failed
+	};
+
+	/** The staging copy, reused across readbacks. */
+	TUniquePtr<FRHIGPUTextureReadback> Readback;
+
+	/** Progress of the current readback, written by the render thread. */
+	std::atomic<EState> State;
+
+	/** True while a Poll check is queued on the render thread. */
+	std::atomic<bool> bCheckQueued;
+
+	/** GPU format of the target, set on the render thread when the copy is added. */
+	EPixelFormat PixelFormat;
+
+	/** Destination of the current readback. Only accessed on the render thread. */
+	uint8* Destination = nullptr;
+	FIntPoint DestinationSize = FIntPoint::ZeroValue;
+	int32 DestinationBytesPerPixel = 0;
+};
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TextureRenderTarget2D.h"
+
+/**
+ * Pool of transient render targets shared by all bake operations.
+ * Creating a render target allocates GPU memory and blocks on resource creation, so released targets
+ * are kept alive and handed out again when a later bake asks for the same size and format.
+ * All functions must be called from the game thread.
+ */
+class QUICKBAKER_API FQuickBakerRenderTargetPool
+{
+public:
+	/**
+	 * Gets a linear (non-sRGB) render target of the given size and format.
+	 * The target is protected from garbage collection until it is released. Its previous content is undefined.
+	 *
+	 * @param SizeX The width of the render target.
+	 * @param SizeY The height of the render target.
+	 * @param Format The render target format.
+	 * @return The render target, or nullptr if it could not be created.
+	 */
+	static UTextureRenderTarget2D* Acquire(int32 SizeX, int32 SizeY, ETextureRenderTargetFormat Format);
+
+	/**
+	 * Returns a render target to the pool.
+	 * The oldest idle targets are freed when the idle targets exceed the pool budget.
+	 *
+	 * @param RenderTarget The render target previously returned by Acquire.
+	 */
+	static void Release(UTextureRenderTarget2D* RenderTarget);
+
+	/**
+	 * Frees every idle render target. Called on module shutdown.
+	 */
+	static void Empty();
+
+	/**
+	 * Gets how many Acquire calls since startup were served by an idle target (hits) or had to create one (misses).
+	 *
+	 * @param OutNumHits Receives the number of reused targets.
+	 * @param OutNumMisses Receives the number of created targets.
+	 */
+	static void GetCounters(int32& OutNumHits, int32& OutNumMisses);
+
+	/**
+	 * Gets the GPU memory of a render target's surface.
+	 *
+	 * @param RenderTarget The render target.
+	 * @return Width * Height * bytes per pixel of its format.
+	 */
+	static int64 GetTargetBytes(const UTextureRenderTarget2D* RenderTarget);
+};
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphFwd.h"
+
+class UWorld;
+class UMaterialInterface;
+class UTextureRenderTarget2D;
+
+/**
+ * One material draw into a rectangle of the bake target.
+ */
+struct QUICKBAKER_API FQuickBakerMaterialDraw
+{
+	/** The material to draw. Must stay alive until the rendering commands are flushed. */
+	UMaterialInterface* Material = nullptr;
+
+	/** Top-left corner of the rectangle, in pixels. */
+	FVector2D Position = FVector2D::ZeroVector;
+
+	/** Size of the rectangle in pixels; zero covers the whole target. */
+	FVector2D Size = FVector2D::ZeroVector;
+
+	/** Texture coordinate at the top-left corner. */
+	FVector2D UV0 = FVector2D::ZeroVector;
+
+	/** Texture coordinate at the bottom-right corner. */
+	FVector2D UV1 = FVector2D::UnitVector;
+};
+
+/**
+ * Adds passes that read or write the bake target after the material draw, in the same render graph.
+ * Called on the render thread.
+ */
+using FQuickBakerGraphPasses = TFunction<void(FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget)>;
+
+/**
+ * Draws materials into render targets with a single Render Dependency Graph per bake.
+ * The draws still go through FCanvas, created on the graph builder: a material pixel shader needs a vertex factory
+ * and a mesh pass, and FCanvas's tile renderer is the engine's public path for that outside the Renderer module,
+ * whose fullscreen material shaders are private. All draws of a bake are batched into one canvas pass after an
+ * explicit clear pass, with no per-draw UCanvas setup or mip update. Later GPU passes join the same graph through
+ * FQuickBakerGraphPasses.
+ */
+class QUICKBAKER_API FQuickBakerRenderer
+{
+public:
+	/**
+	 * Queues a clear to black and the given draws into one render graph. Nothing is flushed; rendering commands are
+	 * ordered, so a following readback on the render thread sees the result.
+	 *
+	 * @param World The world providing the feature level, material parameter collections and time.
+	 * @param RenderTarget The render target to draw into.
+	 * @param Draws The draws, rendered in order.
+	 * @param AfterDraw Optional passes added to the graph after the draws.
+	 * @return True if the draws were queued, false if the world, target or a material is missing.
+	 */
+	static bool DrawMaterials(UWorld* World, UTextureRenderTarget2D* RenderTarget, TConstArrayView<FQuickBakerMaterialDraw> Draws, FQuickBakerGraphPasses AfterDraw = nullptr);
+
+	/**
+	 * Queues a clear to black and a draw of one material over the whole render target.
+	 *
+	 * @param World The world providing the feature level, material parameter collections and time.
+	 * @param RenderTarget The render target to draw into.
+	 * @param Material The material to draw.
+	 * @param AfterDraw Optional passes added to the graph after the draw.
+	 * @return True if the draw was queued, false otherwise.
+	 */
+	static bool DrawMaterial(UWorld* World, UTextureRenderTarget2D* RenderTarget, UMaterialInterface* Material, FQuickBakerGraphPasses AfterDraw = nullptr);
+};
@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Materials/MaterialInterface.h"
 #include "Engine/Texture.h"
+#include "Misc/Paths.h"
+#include "QuickBakerPostProcess.h"
+#include "QuickBakerProjectSettings.h" // For EQuickBakerTextureUsage
 
 /**
  * Enum defining the output file type.
@@ -13,7 +16,12 @@ enum class EQuickBakerOutputType : uint8
 {
 	Asset, /**< Create a Texture Asset in the Content Browser */
 	PNG,   /**< Export as a PNG file (8-bit) */
-	EXR    /**< Export as an EXR file (16-bit float) */
+	EXR,   /**< Export as an EXR file (16-bit float) */
+	QOI,   /**< Export as a QOI file (8-bit, lossless, fast to encode) */
+	TGA,   /**< Export as an uncompressed TGA file (8-bit) */
+	DDS,   /**< Export as an uncompressed DDS file (8-bit BGRA or 16-bit float RGBA) */
+	NPY,   /**< Export as a NumPy array of shape (Height, Width, 4) (uint8 or float16) */
+	RAW    /**< Export the bare RGBA pixels with no header (uint8 or float16) */
 };
 
 /**
@@ -25,6 +33,17 @@ enum class EQuickBakerBitDepth : uint8
 	Bit16  /**< 16-bit float per channel (Recommended for Noise/SDF) */
 };
 
+/**
+ * Enum defining how the material is laid out in the output texture.
+ */
+enum class EQuickBakerBakeMode : uint8
+{
+	Single,   /**< Bake the material once into the whole texture */
+	Flipbook, /**< Bake several time steps of the material into a grid of frames */
+	Cubemap,  /**< Bake the six faces of a cubemap (Texture Cube asset, or equirectangular image for files) */
+	UDIM      /**< Bake a grid of UDIM tiles (virtual texture asset, or one file per tile) */
+};
+
 /**
  * Structure to hold all configuration settings for the baking process.
  */
@@ -33,11 +52,14 @@ struct QUICKBAKER_API FQuickBakerSettings
 	/** The material to be baked. */
 	TWeakObjectPtr<UMaterialInterface> SelectedMaterial;
 
-	/** The desired output format (Asset, PNG, EXR). */
+	/** The desired output format (Asset or one of the file formats). */
 	EQuickBakerOutputType OutputType = EQuickBakerOutputType::Asset;
 
-	/** The resolution of the output texture (width and height). */
-	int32 Resolution = 1024;
+	/** The width of the output texture in pixels. Any size is allowed, not only powers of two. */
+	int32 Width = 1024;
+
+	/** The height of the output texture in pixels. */
+	int32 Height = 1024;
 
 	/** The bit depth of the output texture. */
 	EQuickBakerBitDepth BitDepth = EQuickBakerBitDepth::Bit16;
@@ -45,6 +67,86 @@ struct QUICKBAKER_API FQuickBakerSettings
 	/** Compression settings for the texture asset. */
 	TextureCompressionSettings Compression = TC_Default;
 
+	/** What the texture asset is used for at runtime, which picks the output rule applied to it. */
+	EQuickBakerTextureUsage Usage = EQuickBakerTextureUsage::Auto;
+
+	/** How the material is laid out in the output texture. */
+	EQuickBakerBakeMode BakeMode = EQuickBakerBakeMode::Single;
+
+	/** Number of frames baked in Flipbook mode. */
+	int32 FlipbookFrameCount = 16;
+
+	/** Number of frame columns in the flipbook grid. */
+	int32 FlipbookColumns = 4;
+
+	/** Number of frame rows in the flipbook grid. */
+	int32 FlipbookRows = 4;
+
+	/** Scalar material parameter that receives the time (in seconds) of each flipbook frame. */
+	FName TimeParameterName = TEXT("Time");
+
+	/** Time span covered by the flipbook in seconds. Frame N is baked at N * Duration / FrameCount. */
+	float FlipbookDuration = 1.0f;
+
+	/**
+	 * Prefix of the vector material parameters that receive each cubemap face basis:
+	 * <Prefix>Forward, <Prefix>Right and <Prefix>Down. The material builds the sample direction as
+	 * Forward + (2U - 1) * Right + (2V - 1) * Down.
+	 */
+	FName CubeFaceParameterPrefix = TEXT("CubeFace");
+
+	/** Number of UDIM tile columns (U direction), at most 10. */
+	int32 UDIMTilesU = 2;
+
+	/** Number of UDIM tile rows (V direction). */
+	int32 UDIMTilesV = 2;
+
+	/**
+	 * Stores the texture source PNG-compressed (lossless) instead of raw, which shrinks packages of smooth procedural
+	 * textures several-fold. Applies to 8-bit and grayscale 2D assets; float sources and cubemaps are always stored raw.
+	 */
+	bool bCompressSource = false;
+
+	/** Skips saving an existing texture asset when the new pixels match its stored source. */
+	bool bSkipUnchangedAssets = true;
+
+	/**
+	 * Per-channel difference still treated as unchanged when bSkipUnchangedAssets is set.
+	 * In 0-1 units for 8/16-bit normalized sources, absolute for float sources. 0 requires bit-identical pixels.
+	 */
+	float UnchangedTolerance = 0.0f;
+
+	/**
+	 * Analyzes asset bakes after readback and stores them in the smallest format that stays within AutoFormatMaxError:
+	 * grayscale images as one channel, 16-bit data that fits as 8-bit, and constant images as 4x4.
+	 * Ignored for cubemaps and for compression settings with a fixed layout (normal maps, masks, alpha).
+	 */
+	bool bAutoSelectFormat = false;
+
+	/**
+	 * Lets bAutoSelectFormat remap a channel's [Min, Max] range into 8 bits. The scale and bias needed to restore
+	 * the values are stored as package metadata (QuickBaker.RangeScale / QuickBaker.RangeBias).
+	 */
+	bool bAllowRangeRemap = false;
+
+	/** Largest per-channel error in value units that bAutoSelectFormat may introduce. */
+	float AutoFormatMaxError = 0.002f;
+
+	/**
+	 * GPU post-process stages (dilation, blur, levels, normalize) applied in order to the render target between the
+	 * draw and the readback. Dilate and Blur stay within each flipbook frame or cube face; UDIM tiles are processed
+	 * one by one. Empty by default.
+	 */
+	TArray<FQuickBakerPostProcessStage> PostProcessStages;
+
+	/**
+	 * Widths of smaller copies saved next to the main output, e.g. { 1024, 256 } beside a 4096 bake. The material is
+	 * rendered once at Width x Height and each variant is downsampled from it on the GPU, then saved as
+	 * <OutputName>_<Width>. Heights follow the aspect ratio; in Flipbook and Cubemap modes the width is per frame or
+	 * face. Widths not smaller than Width are ignored, and UDIM bakes have no variants.
+	 */
+	TArray<int32> ResolutionVariants;
+
 	/** The name of the output file or asset. */
 	FString OutputName;
 
@@ -54,6 +156,161 @@ struct QUICKBAKER_API FQuickBakerSettings
 	/** Default constructor. */
 	FQuickBakerSettings() {}
 
+	/**
+	 * Gets the file extension of an output type.
+	 *
+	 * @param Type The output type.
+	 * @return The extension without the dot, or an empty string for Asset.
+	 */
+	static const TCHAR* GetFileExtension(EQuickBakerOutputType Type)
+	{
+		switch (Type)
+		{
+		case EQuickBakerOutputType::PNG: return TEXT("png");
+		case EQuickBakerOutputType::EXR: return TEXT("exr");
+		case EQuickBakerOutputType::QOI: return TEXT("qoi");
+		case EQuickBakerOutputType::TGA: return TEXT("tga");
+		case EQuickBakerOutputType::DDS: return TEXT("dds");
+		case EQuickBakerOutputType::NPY: return TEXT("npy");
+		case EQuickBakerOutputType::RAW: return TEXT("raw");
+		default: return TEXT("");
+		}
+	}
+
+	/**
+	 * Gets the file written by a file bake: OutputPath/OutputName with the extension of OutputType.
+	 * UDIM tiles insert their tile number before the extension.
+	 *
+	 * @return The full file system path.
+	 */
+	FString GetOutputFilePath() const
+	{
+		return FPaths::Combine(OutputPath, OutputName + TEXT(".") + GetFileExtension(OutputType));
+	}
+
+	/**
+	 * Gets whether the bit depth setting applies to an output type.
+	 * PNG, QOI and TGA always store 8 bits and EXR always stores 16-bit float.
+	 *
+	 * @param Type The output type.
+	 * @return True if BitDepth chooses the stored precision.
+	 */
+	static bool SupportsBitDepth(EQuickBakerOutputType Type)
+	{
+		return Type == EQuickBakerOutputType::Asset || Type == EQuickBakerOutputType::DDS
+			|| Type == EQuickBakerOutputType::NPY || Type == EQuickBakerOutputType::RAW;
+	}
+
+	/**
+	 * Gets whether file output is read back as 16-bit float (FFloat16Color) rather than 8-bit (FColor) pixels.
+	 *
+	 * @return True for EXR, and for DDS, NPY and RAW at 16-bit depth.
+	 */
+	bool UsesFloatPixels() const
+	{
+		if (OutputType == EQuickBakerOutputType::EXR)
+		{
+			return true;
+		}
+		return SupportsBitDepth(OutputType) && BitDepth == EQuickBakerBitDepth::Bit16;
+	}
+
+	/**
+	 * Gets the grid of cells rendered into the render target.
+	 * Flipbook frames use the configured grid, and cubemap faces are laid out 3x2 to keep the target within
+	 * texture size limits. A single bake is one cell.
+	 *
+	 * @return The number of columns and rows.
+	 */
+	FIntPoint GetCellGrid() const
+	{
+		switch (BakeMode)
+		{
+		case EQuickBakerBakeMode::Flipbook:
+			return FIntPoint(FlipbookColumns, FlipbookRows);
+		case EQuickBakerBakeMode::Cubemap:
+			return FIntPoint(3, 2);
+		default:
+			return FIntPoint(1, 1);
+		}
+	}
+
+	/**
+	 * Gets the size of the render target holding every cell.
+	 * In Flipbook and Cubemap modes, Width and Height are the size of a single frame or face.
+	 * UDIM tiles are rendered one at a time, so in UDIM mode this is the size of a single tile.
+	 *
+	 * @return The render target width and height in pixels.
+	 */
+	FIntPoint GetOutputSize() const
+	{
+		const FIntPoint Grid = GetCellGrid();
+		return FIntPoint(Width * Grid.X, Height * Grid.Y);
+	}
+
+	/**
+	 * Gets the number of tiles baked in UDIM mode.
+	 *
+	 * @return The number of tiles, in row-major order starting at 1001.
+	 */
+	int32 GetUDIMTileCount() const
+	{
+		return UDIMTilesU * UDIMTilesV;
+	}
+
+	/**
+	 * Gets the UDIM tile number of a tile: 1001 + U + 10 * V.
+	 *
+	 * @param TileIndex The tile index in row-major order.
+	 * @return The tile number used in file names.
+	 */
+	int32 GetUDIMTileNumber(int32 TileIndex) const
+	{
+		return 1001 + (TileIndex % UDIMTilesU) + 10 * (TileIndex / UDIMTilesU);
+	}
+
+	/**
+	 * Gets the frame sizes of the resolution variants to save besides the main output.
+	 *
+	 * @return Width and height of each usable entry of ResolutionVariants, largest first, without duplicates.
+	 */
+	TArray<FIntPoint> GetResolutionVariantSizes() const
+	{
+		TArray<FIntPoint> Sizes;
+		if (BakeMode == EQuickBakerBakeMode::UDIM)
+		{
+			return Sizes;
+		}
+
+		for (const int32 VariantWidth : ResolutionVariants)
+		{
+			if (VariantWidth > 0 && VariantWidth < Width)
+			{
+				const int32 VariantHeight = FMath::Max(1, (int32)FMath::RoundToInt((double)Height * VariantWidth / Width));
+				Sizes.AddUnique(FIntPoint(VariantWidth, VariantHeight));
+			}
+		}
+
+		Sizes.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X > B.X; });
+		return Sizes;
+	}
+
+	/**
+	 * Gets the settings that save one resolution variant through the regular output path.
+	 *
+	 * @param VariantSize A size returned by GetResolutionVariantSizes.
+	 * @return A copy of these settings at that size, named <OutputName>_<Width>, without further variants.
+	 */
+	FQuickBakerSettings GetVariantSettings(const FIntPoint& VariantSize) const
+	{
+		FQuickBakerSettings VariantSettings = *this;
+		VariantSettings.Width = VariantSize.X;
+		VariantSettings.Height = VariantSize.Y;
+		VariantSettings.OutputName = FString::Printf(TEXT("%s_%d"), *OutputName, VariantSize.X);
+		VariantSettings.ResolutionVariants.Reset();
+		return VariantSettings;
+	}
+
 	/**
 	 * Validates the settings.
 	 * @return True if the settings are valid, false otherwise.
@@ -65,7 +322,7 @@ struct QUICKBAKER_API FQuickBakerSettings
 			return false;
 		}
 
-		if (Resolution <= 0)
+		if (Width <= 0 || Height <= 0)
 		{
 			return false;
 		}
@@ -75,6 +332,37 @@ struct QUICKBAKER_API FQuickBakerSettings
 			return false;
 		}
 
+		if (BakeMode == EQuickBakerBakeMode::Flipbook)
+		{
+			if (FlipbookFrameCount <= 0 || FlipbookColumns <= 0 || FlipbookRows <= 0)
+			{
+				return false;
+			}
+
+			// Every frame needs its own cell in the grid
+			if ((int64)FlipbookColumns * FlipbookRows < FlipbookFrameCount)
+			{
+				return false;
+			}
+
+			if (TimeParameterName.IsNone())
+			{
+				return false;
+			}
+		}
+
+		// Cube faces are square
+		if (BakeMode == EQuickBakerBakeMode::Cubemap && (CubeFaceParameterPrefix.IsNone() || Width != Height))
+		{
+			return false;
+		}
+
+		// UDIM numbering has ten tiles per row, and tile numbers stop at 1999
+		if (BakeMode == EQuickBakerBakeMode::UDIM && (UDIMTilesU <= 0 || UDIMTilesU > 10 || UDIMTilesV <= 0 || UDIMTilesV > 99))
+		{
+			return false;
+		}
+
 		return true;
 	}
 };
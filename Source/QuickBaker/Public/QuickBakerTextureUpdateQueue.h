@@ -0,0 +1,49 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTexture;
+
+/**
+ * Hands baked textures to the engine's asynchronous texture compiler and reports when they are GPU-ready.
+ * UpdateResource only queues platform compression on the texture compiling manager, which compresses many textures
+ * in parallel in the background; this class tracks them and shows one notification once all have finished.
+ * Rebuilding a texture's GPU resource is also deferred for rebaked textures that nothing is currently drawing:
+ * such textures are queued and updated a few per frame after the bake. Textures rendered within the last second
+ * are still updated immediately so viewports never show stale pixels.
+ * All functions must be called from the game thread.
+ */
+class QUICKBAKER_API FQuickBakerTextureUpdateQueue
+{
+public:
+	/**
+	 * Starts the texture's resource update now, or queues it if the texture is not on screen and deferral is allowed.
+	 * Either way the texture is tracked until its asynchronous compilation has finished.
+	 *
+	 * @param Texture The texture whose source was just replaced and saved.
+	 * @param bAllowDefer True to defer the update when the texture was not rendered recently.
+	 */
+	static void RequestUpdate(UTexture* Texture, bool bAllowDefer = true);
+
+	/**
+	 * Prepares a texture for a change of its source: drops its deferred update and waits for a build still reading
+	 * the previous source on the texture compiler. Call before replacing the source of an existing texture.
+	 *
+	 * @param Texture The texture whose source is about to change.
+	 */
+	static void PrepareSourceChange(UTexture* Texture);
+
+	/**
+	 * Gets the number of textures still waiting for their update or compilation.
+	 *
+	 * @return The number of pending textures.
+	 */
+	static int32 GetNumPending();
+
+	/**
+	 * Drops the queue and its ticker without updating. Called on module shutdown.
+	 */
+	static void Empty();
+};
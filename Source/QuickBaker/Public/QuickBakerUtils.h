@@ -19,4 +19,15 @@ public:
 	 * @return The generated texture name.
 	 */
 	static FString GetTextureNameFromMaterial(const FString& MaterialName);
+
+	/**
+	 * Gets the world-space basis of a cubemap face, in the engine's face order (+X, -X, +Y, -Y, +Z, -Z).
+	 * The direction through face texel (U, V) is Forward + (2U - 1) * Right + (2V - 1) * Down.
+	 *
+	 * @param FaceIndex The face index in [0, 5].
+	 * @param OutForward The direction through the face center.
+	 * @param OutRight The direction of increasing U.
+	 * @param OutDown The direction of increasing V.
+	 */
+	static void GetCubeFaceBasis(int32 FaceIndex, FVector& OutForward, FVector& OutRight, FVector& OutDown);
 };
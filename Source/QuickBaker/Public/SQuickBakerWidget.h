@@ -6,9 +6,13 @@
 #include "Widgets/SCompoundWidget.h"
 #include "QuickBakerSettings.h"
 #include "Engine/Texture.h" // For TextureCompressionSettings
+#include "Styling/SlateBrush.h"
+#include "Styling/SlateTypes.h" // For ECheckBoxState
 
 class FAssetThumbnailPool;
 class FAssetThumbnail;
+class FActiveTimerHandle;
+class UTextureRenderTarget2D;
 
 /**
  * Main Slate Widget for the QuickBaker tool.
@@ -47,20 +51,40 @@ private:
 
 	// Options for ComboBoxes
 	TArray<TSharedPtr<EQuickBakerOutputType>> OutputTypeOptions;
+	TArray<TSharedPtr<EQuickBakerBakeMode>> BakeModeOptions;
 	TArray<TSharedPtr<int32>> ResolutionOptions;
 	TArray<TSharedPtr<EQuickBakerBitDepth>> BitDepthOptions;
 	TArray<TSharedPtr<TextureCompressionSettings>> CompressionOptions;
+	TArray<TSharedPtr<EQuickBakerTextureUsage>> UsageOptions;
 
 	// Current Selections (matching Settings logic but as pointers for ComboBox)
 	TSharedPtr<EQuickBakerOutputType> SelectedOutputType;
+	TSharedPtr<EQuickBakerBakeMode> SelectedBakeMode;
 	TSharedPtr<int32> SelectedResolution;
 	TSharedPtr<EQuickBakerBitDepth> SelectedBitDepth;
 	TSharedPtr<TextureCompressionSettings> SelectedCompression;
+	TSharedPtr<EQuickBakerTextureUsage> SelectedUsage;
 
 	// Thumbnail Helpers
 	TSharedPtr<FAssetThumbnailPool> ThumbnailPool;
 	TSharedPtr<FAssetThumbnail> MaterialThumbnail;
 
+	// Live Preview
+	/**
+	 * Preview render targets, one per refinement step. Held from the render target pool while the widget lives, and
+	 * replaced when the preview size or format changes.
+	 */
+	TArray<UTextureRenderTarget2D*> PreviewTargets;
+
+	/** Brush showing the most refined preview drawn so far. */
+	FSlateBrush PreviewBrush;
+
+	/** Index of the next refinement step to draw. Equal to the step count once the preview is complete. */
+	int32 NextPreviewStep = 0;
+
+	/** Active timer refining the preview. Only registered while refinement is pending. */
+	TSharedPtr<FActiveTimerHandle> PreviewTimerHandle;
+
 	// Warning UI
 	bool bShowMaterialWarning;
 	TSharedPtr<STextBlock> WarningTextBlock;
@@ -68,6 +92,13 @@ private:
 	// Reference to the Compression Row for dynamic visibility control
 	TSharedPtr<SHorizontalBox> CompressionRow;
 
+	// Bake History
+	/** Trend of the selected material and the slowest materials, read from the history file. */
+	FText BakeHistoryText;
+
+	/** Whether the Bake History area is expanded. The history file is only read while it is. */
+	bool bBakeHistoryExpanded = false;
+
 	/**
 	 * Initializes the dropdown options for Resolution, Output Type, Bit Depth, etc.
 	 */
@@ -79,6 +110,29 @@ private:
 	 */
 	void LoadSavedSettings();
 
+	/**
+	 * Restarts the progressive preview from the lowest resolution.
+	 * Called when the material changes or finishes recompiling, and when a setting the preview shows changes.
+	 */
+	void RequestPreviewUpdate();
+
+	/**
+	 * Active timer callback that draws one preview refinement step per tick, so Slate is never blocked.
+	 *
+	 * @param InCurrentTime The current application time.
+	 * @param InDeltaTime The time since the last tick.
+	 * @return Continue while refinement steps remain, Stop once the preview is complete.
+	 */
+	EActiveTimerReturnType UpdatePreview(double InCurrentTime, float InDeltaTime);
+
+	/**
+	 * Callback when any material finishes compiling.
+	 * Refreshes the preview if the selected material was affected.
+	 *
+	 * @param Material The material that finished compiling.
+	 */
+	void OnMaterialCompilationFinished(UMaterialInterface* Material);
+
 	// UI Callbacks
 
 	/**
@@ -104,6 +158,36 @@ private:
 	 */
 	FText GetSelectedOutputTypeText() const;
 
+	/**
+	 * Callback when the Bake Mode selection changes.
+	 *
+	 * @param NewValue The new bake mode selected.
+	 * @param SelectInfo The method by which the selection was made.
+	 */
+	void OnBakeModeChanged(TSharedPtr<EQuickBakerBakeMode> NewValue, ESelectInfo::Type SelectInfo);
+
+	/**
+	 * Generates the widget for a Bake Mode option.
+	 *
+	 * @param InOption The bake mode option.
+	 * @return The widget to display in the dropdown.
+	 */
+	TSharedRef<SWidget> GenerateBakeModeWidget(TSharedPtr<EQuickBakerBakeMode> InOption);
+
+	/**
+	 * Gets the text label for the currently selected Bake Mode.
+	 *
+	 * @return The text label.
+	 */
+	FText GetSelectedBakeModeText() const;
+
+	/**
+	 * Gets the visibility of the rows that only apply to Flipbook mode.
+	 *
+	 * @return Visible in Flipbook mode, Collapsed otherwise.
+	 */
+	EVisibility GetFlipbookVisibility() const;
+
 	/**
 	 * Callback when the selected material changes in the asset picker.
 	 *
@@ -119,13 +203,21 @@ private:
 	FString GetSelectedMaterialPath() const;
 
 	/**
-	 * Callback when the Resolution selection changes.
+	 * Callback when a Resolution preset is picked. Sets both width and height to the preset.
 	 *
 	 * @param NewValue The new resolution selected.
 	 * @param SelectInfo The method by which the selection was made.
 	 */
 	void OnResolutionChanged(TSharedPtr<int32> NewValue, ESelectInfo::Type SelectInfo);
 
+	/**
+	 * Callback when the width or height entry is committed. Saves both to the config.
+	 *
+	 * @param NewValue The committed value.
+	 * @param CommitType How the value was committed.
+	 */
+	void OnResolutionCommitted(int32 NewValue, ETextCommit::Type CommitType);
+
 	/**
 	 * Generates the widget for a Resolution option.
 	 *
@@ -135,12 +227,27 @@ private:
 	TSharedRef<SWidget> GenerateResolutionWidget(TSharedPtr<int32> InOption);
 
 	/**
-	 * Gets the text label for the currently selected Resolution.
+	 * Gets the text label of the Resolution preset dropdown.
 	 *
 	 * @return The text label.
 	 */
 	FText GetSelectedResolutionText() const;
 
+	/**
+	 * Gets the resolution variant widths as comma-separated text.
+	 *
+	 * @return The text shown in the Resolution Variants box.
+	 */
+	FText GetResolutionVariantsText() const;
+
+	/**
+	 * Callback when the Resolution Variants text is committed. Parses the positive widths it lists.
+	 *
+	 * @param NewText The committed text.
+	 * @param CommitType How the text was committed.
+	 */
+	void OnResolutionVariantsCommitted(const FText& NewText, ETextCommit::Type CommitType);
+
 	/**
 	 * Callback when the Bit Depth selection changes.
 	 *
@@ -187,6 +294,77 @@ private:
 	 */
 	FText GetSelectedCompressionText() const;
 
+	/**
+	 * Callback when the Texture Usage selection changes.
+	 *
+	 * @param NewValue The new usage selected.
+	 * @param SelectInfo The method by which the selection was made.
+	 */
+	void OnUsageChanged(TSharedPtr<EQuickBakerTextureUsage> NewValue, ESelectInfo::Type SelectInfo);
+
+	/**
+	 * Generates the widget for a Texture Usage option.
+	 *
+	 * @param InOption The usage option.
+	 * @return The widget to display in the dropdown.
+	 */
+	TSharedRef<SWidget> GenerateUsageWidget(TSharedPtr<EQuickBakerTextureUsage> InOption);
+
+	/**
+	 * Gets the text label for the currently selected Texture Usage.
+	 *
+	 * @return The text label.
+	 */
+	FText GetSelectedUsageText() const;
+
+	/**
+	 * Callback when the Compress Source checkbox changes.
+	 *
+	 * @param NewState The new check state.
+	 */
+	void OnCompressSourceChanged(ECheckBoxState NewState);
+
+	/**
+	 * Gets a stage of the post-process chain.
+	 *
+	 * @param Type The stage type.
+	 * @return The stage, or nullptr if it is not in the chain.
+	 */
+	FQuickBakerPostProcessStage* FindPostProcessStage(EQuickBakerPostProcessType Type);
+
+	/**
+	 * Callback when a post-process stage checkbox changes.
+	 * Adds or removes the stage, keeping the chain in SignedDistance, Dilate, Blur, Levels, Normalize order.
+	 *
+	 * @param NewState The new check state.
+	 * @param Type The stage type.
+	 */
+	void OnPostProcessStageToggled(ECheckBoxState NewState, EQuickBakerPostProcessType Type);
+
+	/**
+	 * Creates the row of a post-process stage: an enable checkbox, a label, and the stage's parameter boxes,
+	 * which are disabled while the stage is off.
+	 *
+	 * @param Type The stage type.
+	 * @param Label The stage label.
+	 * @param ToolTip The tooltip of the checkbox.
+	 * @param Parameters The parameter widgets, or SNullWidget::NullWidget for none.
+	 * @return The row widget.
+	 */
+	TSharedRef<SWidget> MakePostProcessRow(EQuickBakerPostProcessType Type, const FText& Label, const FText& ToolTip, TSharedRef<SWidget> Parameters);
+
+	/**
+	 * Creates a numeric entry box editing one float parameter of a post-process stage.
+	 *
+	 * @param Type The stage type.
+	 * @param Member The edited parameter.
+	 * @param MinValue The smallest allowed value.
+	 * @param MaxValue The largest allowed value.
+	 * @param ToolTip The tooltip of the box.
+	 * @return The entry box.
+	 */
+	TSharedRef<SWidget> MakePostProcessValueBox(EQuickBakerPostProcessType Type, float FQuickBakerPostProcessStage::* Member, float MinValue, float MaxValue, const FText& ToolTip);
+
 	/**
 	 * Callback when the Output Name text changes.
 	 *
@@ -202,6 +380,18 @@ private:
 	 */
 	FReply OnBakeClicked();
 
+	/**
+	 * Re-reads the bake history and rebuilds the Bake History text, if the area is expanded.
+	 */
+	void RefreshBakeHistory();
+
+	/**
+	 * Callback when the Bake History area is expanded or collapsed.
+	 *
+	 * @param bExpanded Whether the area is now expanded.
+	 */
+	void OnBakeHistoryExpansionChanged(bool bExpanded);
+
 	/**
 	 * Callback when the "Browse" button is clicked.
 	 * Opens a dialog to select the output path.
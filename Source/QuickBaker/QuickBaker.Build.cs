@@ -26,6 +26,7 @@ public class QuickBaker : ModuleRules
 			new string[]
 			{
 				"Core",
+				"QuickBakerShaders", // FQuickBakerPostProcessStage is part of FQuickBakerSettings
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -49,10 +50,16 @@ public class QuickBaker : ModuleRules
 				"ContentBrowser",
 				"DesktopPlatform",
 				"ImageWrapper",
+				"ImageCore",
 				"RenderCore",
 				"RHI",
 				"RHICore",
 				"Settings",
+				"Json",
+				"Sockets",
+				"Networking",
+				"TargetPlatform",
+				"QuickBakerRuntime",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,22 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerAtlasData.h"
+
+bool UQuickBakerAtlasData::FindEntry(FName Name, FQuickBakerAtlasEntry& OutEntry) const
+{
+	// Comparing names is an integer compare, so a scan stays cheap for atlases of a few hundred items
+	const FQuickBakerAtlasEntry* Entry = Entries.FindByPredicate([Name](const FQuickBakerAtlasEntry& Candidate) { return Candidate.Name == Name; });
+	if (!Entry)
+	{
+		return false;
+	}
+
+	OutEntry = *Entry;
+	return true;
+}
+
+FLinearColor UQuickBakerAtlasData::GetUVScaleBias(FName Name) const
+{
+	FQuickBakerAtlasEntry Entry;
+	return FindEntry(Name, Entry) ? Entry.GetUVScaleBias() : FLinearColor(1.0f, 1.0f, 0.0f, 0.0f);
+}
@@ -0,0 +1,9 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "Modules/ModuleManager.h"
+
+/**
+ * Module holding the types baked content refers to at runtime, such as atlas lookup assets.
+ * Unlike the editor modules it is cooked with the game, on every platform.
+ */
+IMPLEMENT_MODULE(FDefaultModuleImpl, QuickBakerRuntime)
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "QuickBakerAtlasData.generated.h"
+
+class UTexture;
+
+/**
+ * Region of one baked item in an atlas texture.
+ */
+USTRUCT(BlueprintType)
+struct QUICKBAKERRUNTIME_API FQuickBakerAtlasEntry
+{
+	GENERATED_BODY()
+
+	/** Name of the item, by default the name of its material. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FName Name;
+
+	/** Top-left corner of the item in pixels, excluding padding. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FIntPoint Position = FIntPoint::ZeroValue;
+
+	/** Size of the item in pixels. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	/** Texture coordinate of the item's top-left corner. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FVector2D UVMin = FVector2D::ZeroVector;
+
+	/** Texture coordinate of the item's bottom-right corner. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FVector2D UVMax = FVector2D::UnitVector;
+
+	/**
+	 * Gets the scale and bias mapping the item's 0-1 UVs into the atlas, packed for a vector material parameter:
+	 * AtlasUV = UV * (R, G) + (B, A).
+	 *
+	 * @return The scale in R and G, the bias in B and A.
+	 */
+	FLinearColor GetUVScaleBias() const
+	{
+		return FLinearColor(UVMax.X - UVMin.X, UVMax.Y - UVMin.Y, UVMin.X, UVMin.Y);
+	}
+};
+
+/**
+ * Lookup of the item regions of an atlas baked by QuickBaker, saved next to the atlas texture.
+ */
+UCLASS(BlueprintType)
+class QUICKBAKERRUNTIME_API UQuickBakerAtlasData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** The atlas texture. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	TSoftObjectPtr<UTexture> Texture;
+
+	/** Size of the atlas texture in pixels. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	FIntPoint AtlasSize = FIntPoint::ZeroValue;
+
+	/** Padding around each item in pixels. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	int32 Padding = 0;
+
+	/** Regions of the items, in the order they were given. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Atlas")
+	TArray<FQuickBakerAtlasEntry> Entries;
+
+	/**
+	 * Finds the region of an item by name.
+	 *
+	 * @param Name The item name.
+	 * @param OutEntry Receives the region.
+	 * @return False if the atlas has no item of that name.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "QuickBaker|Atlas")
+	bool FindEntry(FName Name, FQuickBakerAtlasEntry& OutEntry) const;
+
+	/**
+	 * Gets the UV scale and bias of an item, for a vector material parameter: AtlasUV = UV * (R, G) + (B, A).
+	 *
+	 * @param Name The item name.
+	 * @return The scale and bias, or (1, 1, 0, 0) if the atlas has no item of that name.
+	 */
+	UFUNCTION(BlueprintPure, Category = "QuickBaker|Atlas")
+	FLinearColor GetUVScaleBias(FName Name) const;
+};
@@ -0,0 +1,20 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+using UnrealBuildTool;
+
+public class QuickBakerRuntime : ModuleRules
+{
+	public QuickBakerRuntime(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+			}
+			);
+	}
+}
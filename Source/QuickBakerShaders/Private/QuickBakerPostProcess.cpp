@@ -0,0 +1,435 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "QuickBakerPostProcess.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "SystemTextures.h"
+
+namespace QuickBakerPostProcess
+{
+	static constexpr int32 ThreadGroupSize = 8;
+
+	/** Base for the post-process compute shaders, which only need SM5. */
+	class FPostProcessShader : public FGlobalShader
+	{
+	public:
+		FPostProcessShader() = default;
+		FPostProcessShader(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+			: FGlobalShader(Initializer)
+		{
+		}
+
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+		{
+			return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		}
+	};
+
+	class FJumpFloodInitCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FJumpFloodInitCS);
+		SHADER_USE_PARAMETER_STRUCT(FJumpFloodInitCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint4>, OutputSeeds)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(float, SdfThreshold)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FJumpFloodStepCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FJumpFloodStepCS);
+		SHADER_USE_PARAMETER_STRUCT(FJumpFloodStepCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint4>, InputSeeds)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint4>, OutputSeeds)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(FUintVector2, CellSize)
+			SHADER_PARAMETER(int32, JumpStep)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FSignedDistanceCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FSignedDistanceCS);
+		SHADER_USE_PARAMETER_STRUCT(FSignedDistanceCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint4>, InputSeeds)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(float, SdfThreshold)
+			SHADER_PARAMETER(float, SdfInvSpread)
+			SHADER_PARAMETER(uint32, bEncodeUnsigned)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FDilateCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FDilateCS);
+		SHADER_USE_PARAMETER_STRUCT(FDilateCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, InputCoverage)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, OutputCoverage)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(FUintVector2, CellSize)
+			SHADER_PARAMETER(uint32, bFirstIteration)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FBlurCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FBlurCS);
+		SHADER_USE_PARAMETER_STRUCT(FBlurCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(FUintVector2, CellSize)
+			SHADER_PARAMETER(FIntPoint, BlurDirection)
+			SHADER_PARAMETER(int32, BlurRadius)
+			SHADER_PARAMETER(float, BlurSigma)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FLevelsCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FLevelsCS);
+		SHADER_USE_PARAMETER_STRUCT(FLevelsCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(float, LevelsInBlack)
+			SHADER_PARAMETER(float, LevelsInWhite)
+			SHADER_PARAMETER(float, LevelsInvGamma)
+			SHADER_PARAMETER(float, LevelsOutBlack)
+			SHADER_PARAMETER(float, LevelsOutWhite)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FNormalizeReduceCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FNormalizeReduceCS);
+		SHADER_USE_PARAMETER_STRUCT(FNormalizeReduceCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OutputRange)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FNormalizeApplyCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FNormalizeApplyCS);
+		SHADER_USE_PARAMETER_STRUCT(FNormalizeApplyCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, InputRange)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FCopyCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FCopyCS);
+		SHADER_USE_PARAMETER_STRUCT(FCopyCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	class FDownsampleCS : public FPostProcessShader
+	{
+		DECLARE_GLOBAL_SHADER(FDownsampleCS);
+		SHADER_USE_PARAMETER_STRUCT(FDownsampleCS, FPostProcessShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, InputTexture)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutputTexture)
+			SHADER_PARAMETER(FUintVector2, TextureSize)
+			SHADER_PARAMETER(FUintVector2, OutputSize)
+			SHADER_PARAMETER(FVector2f, DownsampleScale)
+		END_SHADER_PARAMETER_STRUCT()
+	};
+
+	IMPLEMENT_GLOBAL_SHADER(FJumpFloodInitCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "JumpFloodInitCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FJumpFloodStepCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "JumpFloodStepCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FSignedDistanceCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "SignedDistanceCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FDilateCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "DilateCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FBlurCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "BlurCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FLevelsCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "LevelsCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FNormalizeReduceCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "NormalizeReduceCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FNormalizeApplyCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "NormalizeApplyCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FCopyCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "CopyCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FDownsampleCS, "/Plugin/QuickBaker/Private/QuickBakerPostProcess.usf", "DownsampleCS", SF_Compute);
+
+	/** Adds one full-image dispatch of a post-process shader. */
+	template <typename ShaderType>
+	static void AddDispatch(FRDGBuilder& GraphBuilder, FRDGEventName&& PassName, typename ShaderType::FParameters* Parameters, const FIntPoint& Size)
+	{
+		TShaderMapRef<ShaderType> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		FComputeShaderUtils::AddPass(GraphBuilder, MoveTemp(PassName), ComputeShader, Parameters, FComputeShaderUtils::GetGroupCount(Size, ThreadGroupSize));
+	}
+}
+
+void FQuickBakerPostProcess::AddPasses(FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget, TConstArrayView<FQuickBakerPostProcessStage> Stages, const FIntPoint& CellSize)
+{
+	using namespace QuickBakerPostProcess;
+
+	if (Stages.IsEmpty() || !BakeTarget)
+	{
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "QuickBakerPostProcess");
+
+	const FIntPoint Size = BakeTarget->Desc.Extent;
+	const FUintVector2 TextureSize(Size.X, Size.Y);
+	const FUintVector2 ClampedCellSize(FMath::Clamp(CellSize.X, 1, Size.X), FMath::Clamp(CellSize.Y, 1, Size.Y));
+
+	// 32-bit float targets keep full precision; everything else fits in half floats
+	const EPixelFormat TargetFormat = BakeTarget->Desc.Format;
+	const bool bIsFullFloat = TargetFormat == PF_R32_FLOAT || TargetFormat == PF_G32R32F || TargetFormat == PF_A32B32G32R32F;
+	const bool bIsFloatTarget = bIsFullFloat || TargetFormat == PF_R16F || TargetFormat == PF_G16R16F || TargetFormat == PF_FloatRGBA;
+	const FRDGTextureDesc IntermediateDesc = FRDGTextureDesc::Create2D(
+		Size, bIsFullFloat ? PF_A32B32G32R32F : PF_FloatRGBA, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV);
+
+	// Every dispatch writes a fresh intermediate; RDG recycles their memory once the next pass has read them
+	FRDGTextureRef Current = BakeTarget;
+	auto CreateIntermediate = [&GraphBuilder, &IntermediateDesc]()
+	{
+		return GraphBuilder.CreateTexture(IntermediateDesc, TEXT("QuickBakerPostProcess"));
+	};
+
+	for (const FQuickBakerPostProcessStage& Stage : Stages)
+	{
+		switch (Stage.Type)
+		{
+		case EQuickBakerPostProcessType::SignedDistance:
+		{
+			// Seeds hold the nearest inside (xy) and outside (zw) pixel; 16 bits cover every texture size
+			const FRDGTextureDesc SeedDesc = FRDGTextureDesc::Create2D(Size, PF_R16G16B16A16_UINT, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV);
+			FRDGTextureRef Seeds = GraphBuilder.CreateTexture(SeedDesc, TEXT("QuickBakerJumpFloodSeeds"));
+
+			FJumpFloodInitCS::FParameters* InitParameters = GraphBuilder.AllocParameters<FJumpFloodInitCS::FParameters>();
+			InitParameters->InputTexture = Current;
+			InitParameters->OutputSeeds = GraphBuilder.CreateUAV(Seeds);
+			InitParameters->TextureSize = TextureSize;
+			InitParameters->SdfThreshold = Stage.Threshold;
+			AddDispatch<FJumpFloodInitCS>(GraphBuilder, RDG_EVENT_NAME("JumpFloodInit"), InitParameters, Size);
+
+			// Halving steps from half the cell size down to 1, plus one extra step of 1 to fix most of JFA's errors
+			TArray<int32, TInlineAllocator<16>> JumpSteps;
+			for (int32 JumpStep = (int32)FMath::RoundUpToPowerOfTwo(FMath::Max(ClampedCellSize.X, ClampedCellSize.Y)) / 2; JumpStep >= 1; JumpStep /= 2)
+			{
+				JumpSteps.Add(JumpStep);
+			}
+			JumpSteps.Add(1);
+
+			for (const int32 JumpStep : JumpSteps)
+			{
+				FRDGTextureRef OutputSeeds = GraphBuilder.CreateTexture(SeedDesc, TEXT("QuickBakerJumpFloodSeeds"));
+
+				FJumpFloodStepCS::FParameters* StepParameters = GraphBuilder.AllocParameters<FJumpFloodStepCS::FParameters>();
+				StepParameters->InputSeeds = Seeds;
+				StepParameters->OutputSeeds = GraphBuilder.CreateUAV(OutputSeeds);
+				StepParameters->TextureSize = TextureSize;
+				StepParameters->CellSize = ClampedCellSize;
+				StepParameters->JumpStep = JumpStep;
+				AddDispatch<FJumpFloodStepCS>(GraphBuilder, RDG_EVENT_NAME("JumpFloodStep %d", JumpStep), StepParameters, Size);
+
+				Seeds = OutputSeeds;
+			}
+
+			FRDGTextureRef Output = CreateIntermediate();
+
+			FSignedDistanceCS::FParameters* DistanceParameters = GraphBuilder.AllocParameters<FSignedDistanceCS::FParameters>();
+			DistanceParameters->InputTexture = Current;
+			DistanceParameters->InputSeeds = Seeds;
+			DistanceParameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+			DistanceParameters->TextureSize = TextureSize;
+			DistanceParameters->SdfThreshold = Stage.Threshold;
+			DistanceParameters->SdfInvSpread = 1.0f / FMath::Max(Stage.Radius, UE_KINDA_SMALL_NUMBER);
+			DistanceParameters->bEncodeUnsigned = bIsFloatTarget ? 0 : 1;
+			AddDispatch<FSignedDistanceCS>(GraphBuilder, RDG_EVENT_NAME("SignedDistance"), DistanceParameters, Size);
+
+			Current = Output;
+			break;
+		}
+		case EQuickBakerPostProcessType::Dilate:
+		{
+			const int32 Iterations = FMath::Clamp(FMath::RoundToInt(Stage.Radius), 0, MaxRadius);
+			const FRDGTextureDesc CoverageDesc = FRDGTextureDesc::Create2D(Size, PF_R8, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV);
+			FRDGTextureRef Coverage = GSystemTextures.GetBlackDummy(GraphBuilder);
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FRDGTextureRef Output = CreateIntermediate();
+				FRDGTextureRef OutputCoverage = GraphBuilder.CreateTexture(CoverageDesc, TEXT("QuickBakerDilateCoverage"));
+
+				FDilateCS::FParameters* Parameters = GraphBuilder.AllocParameters<FDilateCS::FParameters>();
+				Parameters->InputTexture = Current;
+				Parameters->InputCoverage = Coverage;
+				Parameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+				Parameters->OutputCoverage = GraphBuilder.CreateUAV(OutputCoverage);
+				Parameters->TextureSize = TextureSize;
+				Parameters->CellSize = ClampedCellSize;
+				Parameters->bFirstIteration = Iteration == 0 ? 1 : 0;
+				AddDispatch<FDilateCS>(GraphBuilder, RDG_EVENT_NAME("Dilate %d", Iteration), Parameters, Size);
+
+				Current = Output;
+				Coverage = OutputCoverage;
+			}
+			break;
+		}
+		case EQuickBakerPostProcessType::Blur:
+		{
+			const float Sigma = FMath::Clamp(Stage.Radius, 0.0f, (float)MaxRadius) * 0.5f;
+			const int32 Radius = FMath::CeilToInt(Sigma * 2.0f);
+			if (Radius <= 0)
+			{
+				break;
+			}
+
+			for (const FIntPoint& Direction : { FIntPoint(1, 0), FIntPoint(0, 1) })
+			{
+				FRDGTextureRef Output = CreateIntermediate();
+
+				FBlurCS::FParameters* Parameters = GraphBuilder.AllocParameters<FBlurCS::FParameters>();
+				Parameters->InputTexture = Current;
+				Parameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+				Parameters->TextureSize = TextureSize;
+				Parameters->CellSize = ClampedCellSize;
+				Parameters->BlurDirection = Direction;
+				Parameters->BlurRadius = Radius;
+				Parameters->BlurSigma = Sigma;
+				AddDispatch<FBlurCS>(GraphBuilder, RDG_EVENT_NAME("Blur %s", Direction.X ? TEXT("X") : TEXT("Y")), Parameters, Size);
+
+				Current = Output;
+			}
+			break;
+		}
+		case EQuickBakerPostProcessType::Levels:
+		{
+			FRDGTextureRef Output = CreateIntermediate();
+
+			FLevelsCS::FParameters* Parameters = GraphBuilder.AllocParameters<FLevelsCS::FParameters>();
+			Parameters->InputTexture = Current;
+			Parameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+			Parameters->TextureSize = TextureSize;
+			Parameters->LevelsInBlack = Stage.InBlack;
+			Parameters->LevelsInWhite = Stage.InWhite;
+			Parameters->LevelsInvGamma = 1.0f / FMath::Max(Stage.Gamma, UE_KINDA_SMALL_NUMBER);
+			Parameters->LevelsOutBlack = Stage.OutBlack;
+			Parameters->LevelsOutWhite = Stage.OutWhite;
+			AddDispatch<FLevelsCS>(GraphBuilder, RDG_EVENT_NAME("Levels"), Parameters, Size);
+
+			Current = Output;
+			break;
+		}
+		case EQuickBakerPostProcessType::Normalize:
+		{
+			// Two slots (min, inverted max), both reduced with atomic min from all ones
+			FRDGBufferRef Range = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 2), TEXT("QuickBakerNormalizeRange"));
+			FRDGBufferUAVRef RangeUAV = GraphBuilder.CreateUAV(Range);
+			AddClearUAVPass(GraphBuilder, RangeUAV, 0xFFFFFFFFu);
+
+			FNormalizeReduceCS::FParameters* ReduceParameters = GraphBuilder.AllocParameters<FNormalizeReduceCS::FParameters>();
+			ReduceParameters->InputTexture = Current;
+			ReduceParameters->OutputRange = RangeUAV;
+			ReduceParameters->TextureSize = TextureSize;
+			AddDispatch<FNormalizeReduceCS>(GraphBuilder, RDG_EVENT_NAME("NormalizeReduce"), ReduceParameters, Size);
+
+			FRDGTextureRef Output = CreateIntermediate();
+
+			FNormalizeApplyCS::FParameters* ApplyParameters = GraphBuilder.AllocParameters<FNormalizeApplyCS::FParameters>();
+			ApplyParameters->InputTexture = Current;
+			ApplyParameters->InputRange = GraphBuilder.CreateSRV(Range);
+			ApplyParameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+			ApplyParameters->TextureSize = TextureSize;
+			AddDispatch<FNormalizeApplyCS>(GraphBuilder, RDG_EVENT_NAME("NormalizeApply"), ApplyParameters, Size);
+
+			Current = Output;
+			break;
+		}
+		}
+	}
+
+	// Stages with nothing to do (zero radius) leave the target untouched
+	if (Current == BakeTarget)
+	{
+		return;
+	}
+
+	FCopyCS::FParameters* CopyParameters = GraphBuilder.AllocParameters<FCopyCS::FParameters>();
+	CopyParameters->InputTexture = Current;
+	CopyParameters->OutputTexture = GraphBuilder.CreateUAV(BakeTarget);
+	CopyParameters->TextureSize = TextureSize;
+	AddDispatch<FCopyCS>(GraphBuilder, RDG_EVENT_NAME("CopyToBakeTarget"), CopyParameters, Size);
+}
+
+void FQuickBakerPostProcess::AddDownsamplePasses(FRDGBuilder& GraphBuilder, FRDGTextureRef Source, FRDGTextureRef Destination)
+{
+	using namespace QuickBakerPostProcess;
+
+	if (!Source || !Destination)
+	{
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "QuickBakerDownsample");
+
+	const FIntPoint SourceSize = Source->Desc.Extent;
+	const FIntPoint DestinationSize = Destination->Desc.Extent;
+
+	// Sizes from the destination up: each step is the one below times MaxDownsampleStep, capped at the source size.
+	// Every pass but the first then shrinks by an exact integer factor, so the chain equals one box filter over the
+	// whole footprint while no thread averages more than MaxDownsampleStep squared pixels.
+	TArray<FIntPoint, TInlineAllocator<8>> Sizes;
+	Sizes.Add(DestinationSize);
+	while (Sizes.Last().X * MaxDownsampleStep < SourceSize.X || Sizes.Last().Y * MaxDownsampleStep < SourceSize.Y)
+	{
+		const FIntPoint& Previous = Sizes.Last();
+		Sizes.Add(FIntPoint(FMath::Min(Previous.X * MaxDownsampleStep, SourceSize.X), FMath::Min(Previous.Y * MaxDownsampleStep, SourceSize.Y)));
+	}
+
+	const EPixelFormat SourceFormat = Source->Desc.Format;
+	const bool bIsFullFloat = SourceFormat == PF_R32_FLOAT || SourceFormat == PF_G32R32F || SourceFormat == PF_A32B32G32R32F;
+
+	FRDGTextureRef Current = Source;
+	for (int32 SizeIndex = Sizes.Num() - 1; SizeIndex >= 0; --SizeIndex)
+	{
+		const FIntPoint InputSize = Current->Desc.Extent;
+		const FIntPoint OutputSize = Sizes[SizeIndex];
+		FRDGTextureRef Output = (SizeIndex == 0)
+			? Destination
+			: GraphBuilder.CreateTexture(FRDGTextureDesc::Create2D(OutputSize, bIsFullFloat ? PF_A32B32G32R32F : PF_FloatRGBA, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV), TEXT("QuickBakerDownsample"));
+
+		FDownsampleCS::FParameters* Parameters = GraphBuilder.AllocParameters<FDownsampleCS::FParameters>();
+		Parameters->InputTexture = Current;
+		Parameters->OutputTexture = GraphBuilder.CreateUAV(Output);
+		Parameters->TextureSize = FUintVector2(InputSize.X, InputSize.Y);
+		Parameters->OutputSize = FUintVector2(OutputSize.X, OutputSize.Y);
+		Parameters->DownsampleScale = FVector2f((float)InputSize.X / OutputSize.X, (float)InputSize.Y / OutputSize.Y);
+		AddDispatch<FDownsampleCS>(GraphBuilder, RDG_EVENT_NAME("Downsample %dx%d", OutputSize.X, OutputSize.Y), Parameters, OutputSize);
+
+		Current = Output;
+	}
+}
@@ -0,0 +1,26 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#include "Modules/ModuleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "ShaderCore.h"
+
+/**
+ * Module holding QuickBaker's global shaders.
+ * Loaded at PostConfigInit, since shader types must be registered before the engine compiles its global shader map.
+ */
+class FQuickBakerShadersModule : public IModuleInterface
+{
+public:
+	/**
+	 * Called when the module is started up.
+	 * Maps the plugin's Shaders directory to /Plugin/QuickBaker.
+	 */
+	virtual void StartupModule() override
+	{
+		const FString ShaderDirectory = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("QuickBaker"))->GetBaseDir(), TEXT("Shaders"));
+		AddShaderSourceDirectoryMapping(TEXT("/Plugin/QuickBaker"), ShaderDirectory);
+	}
+};
+
+IMPLEMENT_MODULE(FQuickBakerShadersModule, QuickBakerShaders)
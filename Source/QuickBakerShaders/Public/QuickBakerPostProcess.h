@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphFwd.h"
+
+/**
+ * Enum defining the operation of a post-process stage.
+ */
+enum class EQuickBakerPostProcessType : uint8
+{
+	SignedDistance, /**< Replace a mask (red channel) with its signed distance field, computed by jump flooding */
+	Dilate,         /**< Grow colors into empty (zero alpha) pixels, e.g. padding around UV islands */
+	Blur,           /**< Separable Gaussian blur */
+	Levels,         /**< Input/output black and white points with gamma, on RGB */
+	Normalize       /**< Remap the RGB value range of the whole image to [0, 1] */
+};
+
+/**
+ * One stage of the GPU post-process chain run on the bake target before readback.
+ */
+struct QUICKBAKERSHADERS_API FQuickBakerPostProcessStage
+{
+	/** The operation of this stage. */
+	EQuickBakerPostProcessType Type = EQuickBakerPostProcessType::Dilate;
+
+	/**
+	 * Dilate: number of pixels to grow (at most 64). Blur: Gaussian radius in pixels (at most 64).
+	 * SignedDistance: spread, the distance in pixels mapped to 1.
+	 */
+	float Radius = 4.0f;
+
+	/** SignedDistance: red channel value above which a pixel is inside the mask. */
+	float Threshold = 0.5f;
+
+	/** Levels: input value mapped to OutBlack. */
+	float InBlack = 0.0f;
+
+	/** Levels: input value mapped to OutWhite. */
+	float InWhite = 1.0f;
+
+	/** Levels: gamma applied between the input and output ranges; above 1 brightens midtones. */
+	float Gamma = 1.0f;
+
+	/** Levels: output value for InBlack. */
+	float OutBlack = 0.0f;
+
+	/** Levels: output value for InWhite. */
+	float OutWhite = 1.0f;
+
+	/** Default constructor. */
+	FQuickBakerPostProcessStage() {}
+
+	/** Creates a stage of the given type with default parameters. */
+	explicit FQuickBakerPostProcessStage(EQuickBakerPostProcessType InType)
+		: Type(InType)
+	{
+	}
+};
+
+/**
+ * GPU compute post-processing for baked images.
+ * The stages run in order on the render graph that drew the bake, so the image is read back only once, already final.
+ * Work happens in float intermediates; the result is written back into the bake target in its own format.
+ * SignedDistance writes the distance to the mask edge divided by the spread and clamped to [-1, 1], positive inside
+ * the mask as in distance field fonts. Float targets store it signed; 8-bit targets store 0.5 + 0.5 * Distance.
+ * The same module also provides the downsample used for resolution variants.
+ */
+class QUICKBAKERSHADERS_API FQuickBakerPostProcess
+{
+public:
+	/** Largest Dilate or Blur radius in pixels. */
+	static constexpr int32 MaxRadius = 64;
+
+	/**
+	 * Adds the passes of a post-process chain. Does nothing for an empty chain.
+	 * The bake target must be created with UAV support.
+	 *
+	 * @param GraphBuilder The render graph to add the passes to.
+	 * @param BakeTarget The texture to read and overwrite with the result.
+	 * @param Stages The stages, applied in order.
+	 * @param CellSize Size of the cells (flipbook frames, cube faces) laid out in the target; Dilate, Blur and
+	 *                 SignedDistance do not sample across cell borders. The target size for a single image.
+	 */
+	static void AddPasses(FRDGBuilder& GraphBuilder, FRDGTextureRef BakeTarget, TConstArrayView<FQuickBakerPostProcessStage> Stages, const FIntPoint& CellSize);
+
+	/** Largest shrink factor per axis of one downsample pass; larger reductions are split into several passes. */
+	static constexpr int32 MaxDownsampleStep = 8;
+
+	/**
+	 * Adds passes that shrink an image into a smaller texture with an area-weighted box filter.
+	 * When the destination is an exact fraction of the source per cell, as for resolution variants of flipbooks and
+	 * cubemaps, no output pixel straddles a cell border.
+	 *
+	 * @param GraphBuilder The render graph to add the passes to.
+	 * @param Source The full-size image.
+	 * @param Destination The texture to fill, at most the source size on each axis, created with UAV support.
+	 */
+	static void AddDownsamplePasses(FRDGBuilder& GraphBuilder, FRDGTextureRef Source, FRDGTextureRef Destination);
+};
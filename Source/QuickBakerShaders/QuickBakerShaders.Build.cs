@@ -0,0 +1,28 @@
+// Copyright (c) 2026 Kurorekishi (EmbarrassingMoment).
+
+using UnrealBuildTool;
+
+public class QuickBakerShaders : ModuleRules
+{
+	public QuickBakerShaders(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"RenderCore",
+			}
+			);
+
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Projects",
+				"RHI",
+			}
+			);
+	}
+}